@@ -144,7 +144,7 @@ esac
 build_odin() {
 	case $1 in
 	debug)
-		EXTRAFLAGS="-g"
+		EXTRAFLAGS="-g -D_DEBUG"
 		;;
 	release)
 		EXTRAFLAGS="-O3"
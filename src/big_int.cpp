@@ -146,12 +146,30 @@ gb_internal i64 big_int_sign(BigInt const *x) {
 }
 
 
+// NOTE: mp_init reserves MP_DEFAULT_DIGIT_COUNT digits (256 bytes on 64-bit targets) for every value, and
+// nearly all integer constants are created through these two procedures, so only reserve the minimum
+// number of digits needed to hold a 64-bit value and let libtommath grow the rare larger results
 gb_internal void big_int_from_u64(BigInt *dst, u64 x) {
-	mp_init_u64(dst, x);
+	mp_init_size(dst, 0);
+	mp_set_u64(dst, x);
 }
 gb_internal void big_int_from_i64(BigInt *dst, i64 x) {
-	mp_init_i64(dst, x);
+	mp_init_size(dst, 0);
+	mp_set_i64(dst, x);
+}
 
+// NOTE: A value of at most one digit (MP_DIGIT_BIT <= 60) always fits in an i64 with headroom, so the
+// sum or difference of two such values cannot overflow an i64 either
+gb_internal bool big_int_get_small_i64(BigInt const *x, i64 *value_) {
+	if (x->used > 1) {
+		return false;
+	}
+	i64 value = x->used == 0 ? 0 : cast(i64)x->dp[0];
+	if (x->sign == MP_NEG) {
+		value = -value;
+	}
+	*value_ = value;
+	return true;
 }
 gb_internal void big_int_init(BigInt *dst, BigInt const *src) {
 	if (dst == src) {
@@ -508,6 +508,8 @@ struct BuildContext {
 
 	u64 vet_flags;
 	u32 sanitizer_flags;
+	bool   pgo_instrument;  // -pgo-instrument
+	String pgo_use_path;    // -pgo-use:<file.profdata>
 	StringSet vet_packages;
 
 	bool   has_resource;
@@ -535,6 +537,9 @@ struct BuildContext {
 	bool   keep_temp_files;
 	bool   ignore_unknown_attributes;
 	bool   no_bounds_check;
+	bool   show_bounds_checks;
+	String optimization_remarks_filter; // -show-optimization-remarks:<filter>, as a pattern of LLVM pass names
+	bool   show_stack_promotions;       // -show-optimization-remarks:stack
 	bool   no_type_assert;
 	bool   dynamic_literals;  // Opt-in to `#+feature dynamic-literals` project-wide.
 	bool   no_output_files;
@@ -553,6 +558,7 @@ struct BuildContext {
 	IntegerDivisionByZeroKind integer_division_by_zero_behaviour;
 
 	LinkerChoice linker_choice;
+	isize        linker_thread_count; // 0 means the linker's own default
 
 	StringSet custom_attributes;
 
@@ -587,6 +593,7 @@ struct BuildContext {
 	bool internal_weak_monomorphization;
 	bool internal_ignore_llvm_verification;
 	bool internal_llvm_no_sroa;
+	bool internal_interner_stats;
 
 	bool   enable_rvo;
 
@@ -2612,6 +2619,22 @@ gb_internal bool init_build_paths(String init_filename) {
 		}
 	}
 
+	if (build_context.pgo_instrument) {
+		switch (build_context.metrics.os) {
+		case TargetOs_linux:
+		case TargetOs_darwin:
+		case TargetOs_freebsd:
+			break;
+		default:
+			gb_printf_err("-pgo-instrument is only supported on Linux, Darwin, and FreeBSD\n");
+			return false;
+		}
+		if (build_context.no_crt) {
+			gb_printf_err("-pgo-instrument cannot be used with -no-crt, the profile runtime requires the C runtime\n");
+			return false;
+		}
+	}
+
 	bool no_crt_checks_failed = false;
 	if (build_context.no_crt && !build_context.ODIN_DEFAULT_TO_NIL_ALLOCATOR && !build_context.ODIN_DEFAULT_TO_PANIC_ALLOCATOR) {
 		switch (build_context.metrics.os) {
@@ -256,7 +256,7 @@ void add_objc_proc_type(CheckerContext *c, Ast *call, Type *return_type, Slice<T
 	try_to_add_package_dependency(c, "runtime", "objc_msgSend_stret");
 
 	Slice<Ast *> args = call->CallExpr.args;
-	if (args.count > 0 && args[0]->tav.objc_super_target) {
+	if (args.count > 0 && args[0]->tav().objc_super_target) {
 		try_to_add_package_dependency(c, "runtime", "objc_msgSendSuper2");
 		try_to_add_package_dependency(c, "runtime", "objc_msgSendSuper2_stret");
 	}
@@ -720,7 +720,7 @@ gb_internal bool check_builtin_objc_procedure(CheckerContext *c, Operand *operan
 
 		// NOTE(harold) Track original type before transforming it to the superclass.
 		//              This is needed because objc_msgSendSuper2 must start its search on the subclass, not the superclass.
-		call->tav.objc_super_target = obj_type;
+		call->tav().objc_super_target = obj_type;
 
 		// The superclass type must be known at compile time. We require this so that the selector method expressions
 		// methods are resolved to the superclass's methods instead of the subclass's.
@@ -5385,7 +5385,7 @@ gb_internal bool check_builtin_procedure(CheckerContext *c, Operand *operand, As
 		isize count_needed = 0;
 
 		for (Ast *arg : ce->args) {
-			ExactValue value = arg->tav.value;
+			ExactValue value = arg->tav().value;
 			GB_ASSERT(value.kind == ExactValue_Compound);
 			ast_node(cl, CompoundLit, value.value_compound);
 			count_needed += cl->elems.count;
@@ -5395,7 +5395,7 @@ gb_internal bool check_builtin_procedure(CheckerContext *c, Operand *operand, As
 		array_init(&new_elems, permanent_allocator(), 0, count_needed);
 
 		for (Ast *arg : ce->args) {
-			ExactValue value = arg->tav.value;
+			ExactValue value = arg->tav().value;
 			GB_ASSERT(value.kind == ExactValue_Compound);
 			ast_node(cl, CompoundLit, value.value_compound);
 			array_add_elems(&new_elems, cl->elems.data, cl->elems.count);
@@ -8290,7 +8290,7 @@ gb_internal bool check_builtin_procedure(CheckerContext *c, Operand *operand, As
 				return false;
 			}
 
-			TypeAndValue tav = proc->tav;
+			TypeAndValue tav = proc->tav();
 
 
 			operand->type       = e->type;
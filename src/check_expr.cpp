@@ -2770,7 +2770,7 @@ gb_internal bool check_is_not_addressable(CheckerContext *c, Operand *o) {
 			return true;
 		}
 		ast_node(ta, TypeAssertion, expr);
-		TypeAndValue tv = ta->expr->tav;
+		TypeAndValue tv = ta->expr->tav();
 		if (is_type_pointer(tv.type)) {
 			return false;
 		}
@@ -2932,6 +2932,14 @@ gb_internal void check_unary_expr(CheckerContext *c, Operand *o, Token op, Ast *
 			return;
 		}
 
+		if (node->kind == Ast_UnaryExpr) {
+			Ast *operand = unparen_expr(node->UnaryExpr.expr);
+			Entity *e = operand->kind == Ast_Ident ? entity_of_node(operand) : nullptr;
+			if (e != nullptr && e->kind == Entity_Variable) {
+				e->flags |= EntityFlag_Reassigned;
+			}
+		}
+
 		if (o->mode == Addressing_SoaVariable) {
 			ast_node(ue, UnaryExpr, node);
 			if (ast_node_expect(ue->expr, Ast_IndexExpr)) {
@@ -4761,9 +4769,9 @@ gb_internal Operand make_operand_from_node(Ast *node) {
 	GB_ASSERT(node != nullptr);
 	Operand x = {};
 	x.expr  = node;
-	x.mode  = node->tav.mode;
-	x.type  = node->tav.type;
-	x.value = node->tav.value;
+	x.mode  = node->tav().mode;
+	x.type  = node->tav().type;
+	x.value = node->tav().value;
 	return x;
 }
 
@@ -4773,8 +4781,8 @@ gb_internal void update_untyped_expr_type(CheckerContext *c, Ast *e, Type *type,
 	ExprInfo *old = check_get_expr_info(c, e);
 	if (old == nullptr) {
 		if (type != nullptr && type != t_invalid) {
-			if (e->tav.type == nullptr || e->tav.type == t_invalid) {
-				add_type_and_value(c, e, e->tav.mode, type ? type : e->tav.type, e->tav.value);
+			if (e->tav().type == nullptr || e->tav().type == t_invalid) {
+				add_type_and_value(c, e, e->tav().mode, type ? type : e->tav().type, e->tav().value);
 				if (e->kind == Ast_TernaryIfExpr) {
 					update_untyped_expr_type(c, e->TernaryIfExpr.x, type, final);
 					update_untyped_expr_type(c, e->TernaryIfExpr.y, type, final);
@@ -5422,11 +5430,11 @@ gb_internal ExactValue get_constant_field_single(CheckerContext *c, ExactValue v
 		}
 
 		if (cl->elems[0]->kind == Ast_FieldValue) {
-			if (is_type_raw_union(node->tav.type)) {
+			if (is_type_raw_union(node->tav().type)) {
 				if (success_) *success_ = false;
 				if (finish_) *finish_ = true;
 				return empty_exact_value;
-			} else if (is_type_struct(node->tav.type)) {
+			} else if (is_type_struct(node->tav().type)) {
 				bool found = false;
 				for (Ast *elem : cl->elems) {
 					if (elem->kind != Ast_FieldValue) {
@@ -5434,10 +5442,10 @@ gb_internal ExactValue get_constant_field_single(CheckerContext *c, ExactValue v
 					}
 					ast_node(fv, FieldValue, elem);
 					auto name = fv->field->Ident.interned;
-					Selection sub_sel = lookup_field(node->tav.type, name, false);
+					Selection sub_sel = lookup_field(node->tav().type, name, false);
 					if (sub_sel.index.count > 0 &&
 					    sub_sel.index[0] == index) {
-						value = fv->value->tav.value;
+						value = fv->value->tav().value;
 						found = true;
 						break;
 					}
@@ -5446,7 +5454,7 @@ gb_internal ExactValue get_constant_field_single(CheckerContext *c, ExactValue v
 					// Use the zero value if it is not found
 					value = {};
 				}
-			} else if (is_type_array(node->tav.type) || is_type_enumerated_array(node->tav.type)) {
+			} else if (is_type_array(node->tav().type) || is_type_enumerated_array(node->tav().type)) {
 				for (Ast *elem : cl->elems) {
 					if (elem->kind != Ast_FieldValue) {
 						continue;
@@ -5454,8 +5462,8 @@ gb_internal ExactValue get_constant_field_single(CheckerContext *c, ExactValue v
 					ast_node(fv, FieldValue, elem);
 					if (is_ast_range(fv->field)) {
 						ast_node(ie, BinaryExpr, fv->field);
-						TypeAndValue lo_tav = ie->left->tav;
-						TypeAndValue hi_tav = ie->right->tav;
+						TypeAndValue lo_tav = ie->left->tav();
+						TypeAndValue hi_tav = ie->right->tav();
 						GB_ASSERT(lo_tav.mode == Addressing_Constant);
 						GB_ASSERT(hi_tav.mode == Addressing_Constant);
 
@@ -5465,28 +5473,28 @@ gb_internal ExactValue get_constant_field_single(CheckerContext *c, ExactValue v
 
 						i64 corrected_index = index;
 
-						if (is_type_enumerated_array(node->tav.type)) {
-							Type *bt = base_type(node->tav.type);
+						if (is_type_enumerated_array(node->tav().type)) {
+							Type *bt = base_type(node->tav().type);
 							GB_ASSERT(bt->kind == Type_EnumeratedArray);
 							corrected_index = index + exact_value_to_i64(*bt->EnumeratedArray.min_value);
 						}
 						if (op != Token_RangeHalf) {
 							if (lo <= corrected_index && corrected_index <= hi) {
-								TypeAndValue tav = fv->value->tav;
+								TypeAndValue tav = fv->value->tav();
 								if (success_) *success_ = true;
 								if (finish_) *finish_ = false;
 								return tav.value;
 							}
 						} else {
 							if (lo <= corrected_index && corrected_index < hi) {
-								TypeAndValue tav = fv->value->tav;
+								TypeAndValue tav = fv->value->tav();
 								if (success_) *success_ = true;
 								if (finish_) *finish_ = false;
 								return tav.value;
 							}
 						}
 					} else {
-						TypeAndValue index_tav = fv->field->tav;
+						TypeAndValue index_tav = fv->field->tav();
 						if (index_tav.mode != Addressing_Constant) {
 							if (success_) *success_ = false;
 							if (finish_) *finish_ = true;
@@ -5494,15 +5502,15 @@ gb_internal ExactValue get_constant_field_single(CheckerContext *c, ExactValue v
 						}
 						GB_ASSERT(index_tav.mode == Addressing_Constant);
 						ExactValue index_value = index_tav.value;
-						if (is_type_enumerated_array(node->tav.type)) {
-							Type *bt = base_type(node->tav.type);
+						if (is_type_enumerated_array(node->tav().type)) {
+							Type *bt = base_type(node->tav().type);
 							GB_ASSERT(bt->kind == Type_EnumeratedArray);
 							index_value = exact_value_sub(index_value, *bt->EnumeratedArray.min_value);
 						}
 
 						i64 field_index = exact_value_to_i64(index_value);
 						if (index == field_index) {
-							TypeAndValue tav = fv->value->tav;
+							TypeAndValue tav = fv->value->tav();
 							if (success_) *success_ = true;
 							if (finish_) *finish_ = false;
 							return tav.value;
@@ -5524,7 +5532,7 @@ gb_internal ExactValue get_constant_field_single(CheckerContext *c, ExactValue v
 				return value;
 			}
 
-			TypeAndValue tav = cl->elems[index]->tav;
+			TypeAndValue tav = cl->elems[index]->tav();
 			if (tav.mode == Addressing_Constant) {
 				if (success_) *success_ = true;
 				if (finish_) *finish_ = false;
@@ -5686,13 +5694,13 @@ gb_internal Entity *check_entity_from_ident_or_selector(CheckerContext *c, Ast *
 		if (we->cond == nullptr) {
 			return nullptr;
 		}
-		if (we->cond->tav.mode != Addressing_Constant) {
+		if (we->cond->tav().mode != Addressing_Constant) {
 			return nullptr;
 		}
-		if (we->cond->tav.value.kind != ExactValue_Bool) {
+		if (we->cond->tav().value.kind != ExactValue_Bool) {
 			return nullptr;
 		}
-		if (we->cond->tav.value.value_bool) {
+		if (we->cond->tav().value.value_bool) {
 			return check_entity_from_ident_or_selector(c, we->x, ident_only);
 		} else {
 			Entity *e = check_entity_from_ident_or_selector(c, we->y, ident_only);
@@ -6964,8 +6972,8 @@ gb_internal CallArgumentError check_call_arguments_internal(CheckerContext *c, A
 
 
 		Ast *proc_lit = nullptr;
-		if (ce->proc->tav.value.kind == ExactValue_Procedure) {
-			Ast *vp = unparen_expr(ce->proc->tav.value.value_procedure);
+		if (ce->proc->tav().value.kind == ExactValue_Procedure) {
+			Ast *vp = unparen_expr(ce->proc->tav().value.value_procedure);
 			if (vp && vp->kind == Ast_ProcLit) {
 				proc_lit = vp;
 			}
@@ -8607,9 +8615,9 @@ gb_internal void check_objc_call_expr(CheckerContext *c, Operand *operand, Ast *
 				ast_node(se, SelectorExpr, ce->proc);
 
 				// NOTE(harold): These should have already been checked, right?
-				GB_ASSERT(se->expr->tav.mode == Addressing_Type && se->expr->tav.type->kind == Type_Named);
+				GB_ASSERT(se->expr->tav().mode == Addressing_Type && se->expr->tav().type->kind == Type_Named);
 
-				return_type = alloc_type_pointer(se->expr->tav.type);
+				return_type = alloc_type_pointer(se->expr->tav().type);
 			} else {
 				return_type = proc_entity->Procedure.objc_class->type;
 			}
@@ -8621,17 +8629,17 @@ gb_internal void check_objc_call_expr(CheckerContext *c, Operand *operand, Ast *
 		GB_ASSERT(ce->args.count > 0);
 		GB_ASSERT(is_type_objc_ptr_to_object(params[0]->type));
 
-		if (ce->args[0]->tav.objc_super_target) {
+		if (ce->args[0]->tav().objc_super_target) {
 			self_type = t_objc_super_ptr;
 		} else {
-			self_type = ce->args[0]->tav.type;
+			self_type = ce->args[0]->tav().type;
 		}
 
 		if (is_return_instancetype) {
 			// NOTE(harold): These should have already been checked, right?
-			GB_ASSERT(ce->args[0]->tav.type && ce->args[0]->tav.type->kind == Type_Pointer && ce->args[0]->tav.type->Pointer.elem->kind == Type_Named);
+			GB_ASSERT(ce->args[0]->tav().type && ce->args[0]->tav().type->kind == Type_Pointer && ce->args[0]->tav().type->Pointer.elem->kind == Type_Named);
 
-			return_type = ce->args[0]->tav.type;
+			return_type = ce->args[0]->tav().type;
 		}
 	}
 
@@ -9448,7 +9456,7 @@ gb_internal void check_matrix_index_expr(CheckerContext *c, Operand *o, Ast *nod
 	i64 column_index = 0;
 	bool row_ok = check_index_value(c, t, false, ie->row_index, row_count, &row_index, nullptr);
 	bool column_ok = check_index_value(c, t, false, ie->column_index, column_count, &column_index, nullptr);
-	if (is_const && (ie->row_index->tav.mode != Addressing_Constant || ie->column_index->tav.mode != Addressing_Constant)) {
+	if (is_const && (ie->row_index->tav().mode != Addressing_Constant || ie->column_index->tav().mode != Addressing_Constant)) {
 		error(o->expr, "Cannot index constant matrix with non-constant indices '%s'", expr_to_string(node));
 	}
 
@@ -11445,7 +11453,7 @@ gb_internal ExprKind check_compound_literal(CheckerContext *c, Operand *o, Ast *
 			for (Ast *e : cl->elems) {
 				GB_ASSERT(e->kind != Ast_FieldValue);
 
-				TypeAndValue tav = e->tav;
+				TypeAndValue tav = e->tav();
 				if (tav.mode != Addressing_Constant) {
 					continue;
 				}
@@ -11659,9 +11667,9 @@ gb_internal ExprKind check_selector_call_expr(CheckerContext *c, Operand *o, Ast
 	if (se->modified_call) {
 		// Prevent double evaluation
 		o->expr  = node;
-		o->type  = node->tav.type;
-		o->value = node->tav.value;
-		o->mode  = node->tav.mode;
+		o->type  = node->tav().type;
+		o->value = node->tav().value;
+		o->mode  = node->tav().mode;
 		return Expr_Expr;
 	}
 
@@ -11724,9 +11732,9 @@ gb_internal ExprKind check_selector_call_expr(CheckerContext *c, Operand *o, Ast
 		}
 
 		Operand y = {};
-		y.mode = first_arg->tav.mode;
-		y.type = first_arg->tav.type;
-		y.value = first_arg->tav.value;
+		y.mode = first_arg->tav().mode;
+		y.type = first_arg->tav().type;
+		y.value = first_arg->tav().value;
 
 		if (check_is_assignable_to(c, &y, first_type)) {
 			// Do nothing, it's valid
@@ -12237,7 +12245,7 @@ gb_internal ExprKind check_expr_base_internal(CheckerContext *c, Operand *o, Ast
 
 	case_ast_node(bl, BasicLit, node);
 		Type *t = t_invalid;
-		switch (node->tav.value.kind) {
+		switch (node->tav().value.kind) {
 		case ExactValue_String:     t = t_untyped_string;     break;
 		case ExactValue_String16:   t = t_string16;           break; // TODO(bill): determine this correctly
 		case ExactValue_Float:      t = t_untyped_float;      break;
@@ -12256,7 +12264,7 @@ gb_internal ExprKind check_expr_base_internal(CheckerContext *c, Operand *o, Ast
 
 		o->mode  = Addressing_Constant;
 		o->type  = t;
-		o->value = node->tav.value;
+		o->value = node->tav().value;
 	case_end;
 
 	case_ast_node(bd, BasicDirective, node);
@@ -12723,10 +12731,10 @@ gb_internal bool is_exact_value_zero(ExactValue const &v) {
 				return true;
 			} else {
 				for (Ast *elem : cl->elems) {
-					if (elem->tav.mode != Addressing_Constant) {
+					if (elem->tav().mode != Addressing_Constant) {
 						return false;
 					}
-					if (!is_exact_value_zero(elem->tav.value)) {
+					if (!is_exact_value_zero(elem->tav().value)) {
 						return false;
 					}
 				}
@@ -12757,7 +12765,7 @@ gb_internal bool compare_exact_values_compound_lit(TokenKind op, ExactValue x, E
 	for (isize i = 0; i < x_cl->elems.count; i++) {
 		Ast *lhs = x_cl->elems[i];
 		Ast *rhs = y_cl->elems[i];
-		if (compare_exact_values(op, lhs->tav.value, rhs->tav.value) != test) {
+		if (compare_exact_values(op, lhs->tav().value, rhs->tav().value) != test) {
 			return !test;
 		}
 	}
@@ -1773,14 +1773,14 @@ gb_internal void destroy_checker(Checker *c) {
 
 gb_internal TypeAndValue type_and_value_of_expr(Ast *expr) {
 	TypeAndValue tav = {};
-	if (expr != nullptr) {
-		tav = expr->tav;
+	if (expr != nullptr && ast_kind_has_tav(expr->kind)) {
+		tav = expr->tav();
 	}
 	return tav;
 }
 
 gb_internal Type *type_of_expr(Ast *expr) {
-	TypeAndValue tav = expr->tav;
+	TypeAndValue tav = type_and_value_of_expr(expr);
 	if (tav.mode != Addressing_Invalid) {
 		return tav.type;
 	}
@@ -1828,10 +1828,10 @@ retry:;
 		if (we->cond == nullptr) {
 			break;
 		}
-		if (we->cond->tav.value.kind != ExactValue_Bool) {
+		if (we->cond->tav().value.kind != ExactValue_Bool) {
 			break;
 		}
-		expr = we->cond->tav.value.value_bool ? we->x : we->y;
+		expr = we->cond->tav().value.value_bool ? we->x : we->y;
 		goto retry;
 	case_end;
 	}
@@ -1985,20 +1985,20 @@ gb_internal void add_type_and_value(CheckerContext *ctx, Ast *expr, AddressingMo
 	Ast *prev_expr = nullptr;
 	while (prev_expr != expr) {
 		prev_expr = expr;
-		expr->tav.mode = mode;
-		if (type != nullptr && expr->tav.type != nullptr &&
-		    is_type_any(type) && is_type_untyped(expr->tav.type)) {
+		expr->tav().mode = mode;
+		if (type != nullptr && expr->tav().type != nullptr &&
+		    is_type_any(type) && is_type_untyped(expr->tav().type)) {
 			// ignore
 		} else {
-			expr->tav.type = type;
+			expr->tav().type = type;
 		}
 
 		if (mode == Addressing_Constant || mode == Addressing_Invalid) {
-			expr->tav.value = value;
+			expr->tav().value = value;
 		} else if (mode == Addressing_Value && type != nullptr && is_type_typeid(type)) {
-			expr->tav.value = value;
+			expr->tav().value = value;
 		} else if (mode == Addressing_Value && type != nullptr && is_type_proc(type)) {
-			expr->tav.value = value;
+			expr->tav().value = value;
 		}
 
 		expr = unparen_expr(expr);
@@ -4856,8 +4856,8 @@ gb_internal void check_collect_value_decl(CheckerContext *c, Ast *decl) {
 				if (value != nullptr) {
 					if (value->kind == Ast_BasicLit && value->BasicLit.token.kind == Token_String) {
 						String v = {};
-						if (value->tav.value.kind == ExactValue_String) {
-							v = value->tav.value.value_string;
+						if (value->tav().value.kind == ExactValue_String) {
+							v = value->tav().value.value_string;
 						}
 						if (v == "file") {
 							kind = EntityVisiblity_PrivateToFile;
@@ -6829,13 +6829,22 @@ gb_internal void add_untyped_expressions(CheckerInfo *cinfo, UntypedExprInfoMap
 	if (untyped == nullptr) {
 		return;
 	}
+	if (untyped->count == 0) {
+		return;
+	}
+	// NOTE: The results stay local to the worker until the end of the procedure (or declaration) and
+	// are then published as one batch, so the workers only touch the shared queue once per map
+	auto *queue = &cinfo->checker->global_untyped_queue;
+	MPSCNode<UntypedExprInfo> *nodes = mpsc_alloc_nodes(queue, untyped->count);
+	isize count = 0;
 	for (auto const &entry : *untyped) {
 		Ast *expr = entry.key;
 		ExprInfo *info = entry.value;
 		if (expr != nullptr && info != nullptr) {
-			mpsc_enqueue(&cinfo->checker->global_untyped_queue, UntypedExprInfo{expr, info});
+			nodes[count++].value = UntypedExprInfo{expr, info};
 		}
 	}
+	mpsc_enqueue_nodes(queue, nodes, count);
 	map_clear(untyped);
 }
 
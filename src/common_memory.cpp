@@ -1,6 +1,9 @@
 #if defined(GB_SYSTEM_LINUX)
 #include <malloc.h>
 #endif
+#if !defined(GB_SYSTEM_WINDOWS)
+#include <sys/resource.h>
+#endif
 
 #ifdef __ANDROID__
 
@@ -54,12 +57,36 @@ gb_internal void virtual_memory_init(void) {
 gb_internal Thread *get_current_thread(void);
 
 
+// NOTE: Used to attribute memory to where it was allocated from for `-show-more-timings`
+enum MemoryUsageKind : u8 {
+	MemoryUsage_OtherArena,
+	MemoryUsage_PermanentArena,
+	MemoryUsage_TemporaryArena,
+	MemoryUsage_CheckingArena,
+	MemoryUsage_StaticArena,
+	MemoryUsage_Heap,
+	MemoryUsage_Malloc,
+
+	MemoryUsage_COUNT,
+};
+
+gb_global char const *memory_usage_kind_strings[MemoryUsage_COUNT] = {
+	"other",
+	"permanent",
+	"temporary",
+	"checking",
+	"static",
+	"heap",
+	"malloc",
+};
+
 struct MemoryBlock {
 	MemoryBlock *prev;
 	u8 *         base; 
 	isize        size;
 	isize        used;
 	isize        committed;
+	MemoryUsageKind usage_kind;
 };
 
 struct Arena {
@@ -69,6 +96,7 @@ struct Arena {
 	isize         temp_count;
 	Thread *      parent_thread;
 	bool          custom_arena;
+	MemoryUsageKind usage_kind;
 };
 
 enum { DEFAULT_MINIMUM_BLOCK_SIZE = 8ll*1024ll*1024ll };
@@ -93,12 +121,19 @@ gb_internal isize arena_align_forward_offset(Arena *arena, isize alignment) {
 gb_internal void thread_init_arenas(Thread *t) {
 	t->permanent_arena = gb_alloc_item(heap_allocator(), Arena);
 	t->temporary_arena = gb_alloc_item(heap_allocator(), Arena);
+	t->checking_arena  = gb_alloc_item(heap_allocator(), Arena);
 
 	t->permanent_arena->parent_thread = t;
 	t->temporary_arena->parent_thread = t;
+	t->checking_arena->parent_thread  = t;
 
 	t->permanent_arena->minimum_block_size = DEFAULT_MINIMUM_BLOCK_SIZE;
 	t->temporary_arena->minimum_block_size = DEFAULT_MINIMUM_BLOCK_SIZE;
+	t->checking_arena->minimum_block_size  = DEFAULT_MINIMUM_BLOCK_SIZE;
+
+	t->permanent_arena->usage_kind = MemoryUsage_PermanentArena;
+	t->temporary_arena->usage_kind = MemoryUsage_TemporaryArena;
+	t->checking_arena->usage_kind  = MemoryUsage_CheckingArena;
 }
 
 gb_internal void *arena_alloc(Arena *arena, isize min_size, isize alignment) {
@@ -117,6 +152,7 @@ gb_internal void *arena_alloc(Arena *arena, isize min_size, isize alignment) {
 		isize block_size = gb_max(size, arena->minimum_block_size);
 		
 		MemoryBlock *new_block = virtual_memory_alloc(block_size, true);
+		new_block->usage_kind = arena->usage_kind;
 		new_block->prev = arena->curr_block;
 		arena->curr_block = new_block;
 	}
@@ -147,6 +183,8 @@ struct StaticArena {
 
 enum {STATIC_ARENA_DEFAULT_COMMIT_BLOCK_SIZE = 8<<20};
 
+gb_global std::atomic<isize> global_static_arena_usage;
+
 gb_internal void static_arena_init(StaticArena *arena, isize reserve_size, isize commit_block_size) {
 	GB_ASSERT(gb_is_power_of_two(reserve_size));
 	GB_ASSERT(gb_is_power_of_two(commit_block_size));
@@ -183,6 +221,7 @@ gb_internal void *static_arena_alloc(StaticArena *arena, isize size, isize align
 	}
 	GB_ASSERT_MSG(end-arena->data <= arena->committed, "out of memory for the static arena");
 
+	global_static_arena_usage.fetch_add((end - arena->data) - arena->used, std::memory_order_relaxed);
 	arena->used = end - arena->data;
 
 	return curr;
@@ -504,22 +543,28 @@ gb_internal GB_ALLOCATOR_PROC(arena_allocator_proc) {
 enum ThreadArenaKind : uintptr {
 	ThreadArena_Permanent,
 	ThreadArena_Temporary,
+	ThreadArena_Checking, // NOTE: freed for every thread once type checking has completed
 };
 
-gb_global Arena default_permanent_arena = {nullptr, DEFAULT_MINIMUM_BLOCK_SIZE};
-gb_global Arena default_temporary_arena = {nullptr, DEFAULT_MINIMUM_BLOCK_SIZE};
+gb_global Arena default_permanent_arena = {nullptr, DEFAULT_MINIMUM_BLOCK_SIZE, 0, nullptr, false, MemoryUsage_PermanentArena};
+gb_global Arena default_temporary_arena = {nullptr, DEFAULT_MINIMUM_BLOCK_SIZE, 0, nullptr, false, MemoryUsage_TemporaryArena};
+gb_global Arena default_checking_arena  = {nullptr, DEFAULT_MINIMUM_BLOCK_SIZE, 0, nullptr, false, MemoryUsage_CheckingArena};
 
 
-gb_internal Arena *get_arena(ThreadArenaKind kind) {
-	Thread *t = get_current_thread();
+gb_internal Arena *get_thread_arena(Thread *t, ThreadArenaKind kind) {
 	switch (kind) {
 	case ThreadArena_Permanent: return t ? t->permanent_arena : &default_permanent_arena;
 	case ThreadArena_Temporary: return t ? t->temporary_arena : &default_temporary_arena;
+	case ThreadArena_Checking:  return t ? t->checking_arena  : &default_checking_arena;
 	}
 	GB_PANIC("INVALID ARENA KIND");
 	return nullptr;
 }
 
+gb_internal Arena *get_arena(ThreadArenaKind kind) {
+	return get_thread_arena(get_current_thread(), kind);
+}
+
 template <typename T>
 gb_internal T *arena_alloc_array(Arena *arena, isize count) {
 	return cast(T *)arena_alloc(arena, gb_size_of(T)*count, gb_align_of(T));
@@ -776,6 +821,87 @@ gb_internal GB_ALLOCATOR_PROC(heap_allocator_proc) {
 }
 
 
+struct MemoryUsage {
+	i64 current_rss; // -1 if unknown
+	i64 peak_rss;    // -1 if unknown
+	i64 bytes[MemoryUsage_COUNT]; // -1 if unknown
+};
+
+gb_internal i64 memory_peak_rss(void) {
+#if defined(GB_SYSTEM_WINDOWS)
+	PROCESS_MEMORY_COUNTERS p = {sizeof(p)};
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &p, sizeof(p))) {
+		return cast(i64)p.PeakWorkingSetSize;
+	}
+	return -1;
+#else
+	struct rusage usage = {};
+	if (getrusage(RUSAGE_SELF, &usage) != 0) {
+		return -1;
+	}
+	#if defined(GB_SYSTEM_OSX)
+		return cast(i64)usage.ru_maxrss; // bytes
+	#else
+		return cast(i64)usage.ru_maxrss * 1024; // kilobytes
+	#endif
+#endif
+}
+
+gb_internal i64 memory_current_rss(void) {
+#if defined(GB_SYSTEM_WINDOWS)
+	PROCESS_MEMORY_COUNTERS p = {sizeof(p)};
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &p, sizeof(p))) {
+		return cast(i64)p.WorkingSetSize;
+	}
+	return -1;
+#elif defined(GB_SYSTEM_LINUX)
+	FILE *f = fopen("/proc/self/statm", "r");
+	if (f == nullptr) {
+		return -1;
+	}
+	long long total_pages = 0, resident_pages = 0;
+	int n = fscanf(f, "%lld %lld", &total_pages, &resident_pages);
+	fclose(f);
+	if (n != 2) {
+		return -1;
+	}
+	return cast(i64)resident_pages * cast(i64)DEFAULT_PAGE_SIZE;
+#else
+	return -1;
+#endif
+}
+
+// NOTE: Arena memory is attributed per block through the global block list, so that the hot path of
+// `arena_alloc` does not need to touch any shared counters.
+gb_internal void memory_usage_snapshot(MemoryUsage *usage) {
+	gb_zero_item(usage);
+	usage->current_rss = memory_current_rss();
+	usage->peak_rss    = memory_peak_rss();
+
+	mutex_lock(&global_memory_block_mutex);
+	PlatformMemoryBlock *sentinel = &global_platform_memory_block_sentinel;
+	for (PlatformMemoryBlock *b = sentinel->next; b != nullptr && b != sentinel; b = b->next) {
+		usage->bytes[b->block.usage_kind] += b->block.used;
+	}
+	mutex_unlock(&global_memory_block_mutex);
+
+	usage->bytes[MemoryUsage_StaticArena] = global_static_arena_usage.load(std::memory_order_relaxed);
+
+#if defined(GB_SYSTEM_LINUX)
+	usage->bytes[MemoryUsage_Heap] = total_heap_memory_allocated.load(std::memory_order_relaxed);
+#else
+	usage->bytes[MemoryUsage_Heap] = -1;
+#endif
+
+	// NOTE: everything allocated through malloc, which includes LLVM
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+	struct mallinfo2 mi = mallinfo2();
+	usage->bytes[MemoryUsage_Malloc] = cast(i64)(mi.uordblks + mi.hblkhd);
+#else
+	usage->bytes[MemoryUsage_Malloc] = -1;
+#endif
+}
+
 template <typename T>
 gb_internal isize resize_array_raw(T **array, gbAllocator const &a, isize old_count, isize new_count, isize custom_alignment=1) {
 	GB_ASSERT(new_count >= 0);
@@ -1066,7 +1066,7 @@ gb_internal OdinDocArray<OdinDocScopeEntry> odin_doc_add_pkg_entries(OdinDocWrit
 		if (!pkg->scope->elements.slots[i].hash) {
 			continue;
 		}
-		auto interned = pkg->scope->elements.keys[i];
+		auto interned = pkg->scope->elements.slots[i].key;
 		Entity *e = pkg->scope->elements.slots[i].value;
 		switch (e->kind) {
 		case Entity_Invalid:
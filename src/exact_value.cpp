@@ -766,6 +766,59 @@ gb_internal void match_exact_values(ExactValue *x, ExactValue *y) {
 	compiler_error("match_exact_values: How'd you get here? Invalid ExactValueKind %d", x->kind);
 }
 
+// NOTE: Most integer constants (array lengths, enum values, shift amounts) fit in a single digit, so
+// fold those with native arithmetic and only fall back to mp_int arithmetic for larger operands, for
+// results which could overflow an i64, or for cases whose semantics are left to the big_int procedures
+gb_internal bool exact_value_small_integer_binary_op(TokenKind op, i64 a, i64 b, i64 *res) {
+	switch (op) {
+	case Token_Add: *res = a + b; return true;
+	case Token_Sub: *res = a - b; return true;
+	case Token_Mul: {
+		u64 ua = a < 0 ? cast(u64)-a : cast(u64)a;
+		u64 ub = b < 0 ? cast(u64)-b : cast(u64)b;
+		u64 lo = 0, hi = 0;
+		mul_overflow_u64(ua, ub, &lo, &hi);
+		if (hi != 0 || lo > cast(u64)INT64_MAX) {
+			return false;
+		}
+		*res = ((a < 0) != (b < 0)) ? -cast(i64)lo : cast(i64)lo;
+		return true;
+	}
+	case Token_QuoEq:
+		if (b == 0) return false;
+		*res = a / b;
+		return true;
+	case Token_Mod:
+		if (b == 0) return false;
+		*res = a % b;
+		return true;
+	case Token_ModMod:
+		if (b == 0) return false;
+		*res = ((a % b) + b) % b;
+		return true;
+	case Token_And:
+	case Token_Or:
+	case Token_Xor:
+		if (a < 0 || b < 0) return false;
+		if (op == Token_And) *res = a & b;
+		if (op == Token_Or)  *res = a | b;
+		if (op == Token_Xor) *res = a ^ b;
+		return true;
+	case Token_Shl:
+		if (a < 0 || b < 0 || b > 62 || (cast(u64)a >> (62 - b)) != 0) {
+			return false;
+		}
+		*res = a << b;
+		return true;
+	case Token_Shr:
+		if (b < 0 || b > 63) return false;
+		// NOTE: arithmetic shift, which rounds towards negative infinity like big_int_shr
+		*res = a >> b;
+		return true;
+	}
+	return false;
+}
+
 gb_internal ExactValue exact_binary_operator_value(TokenKind op, ExactValue x, ExactValue y) {
 	match_exact_values(&x, &y);
 
@@ -788,6 +841,14 @@ gb_internal ExactValue exact_binary_operator_value(TokenKind op, ExactValue x, E
 	case ExactValue_Integer: {
 		BigInt const *a = &x.value_integer;
 		BigInt const *b = &y.value_integer;
+
+		i64 small_a = 0, small_b = 0, small_c = 0;
+		if (big_int_get_small_i64(a, &small_a) &&
+		    big_int_get_small_i64(b, &small_b) &&
+		    exact_value_small_integer_binary_op(op, small_a, small_b, &small_c)) {
+			return exact_value_i64(small_c);
+		}
+
 		BigInt c = {};
 		switch (op) {
 		case Token_Add:    big_int_add(&c, a, b); break;
@@ -18,6 +18,61 @@ gb_internal void linker_enable_system_library_linking(LinkerData *ld) {
 	ld->needs_system_library_linked = true;
 }
 
+// NOTE: Command lines above this length pass the object files through a response file instead
+#define LINKER_RESPONSE_FILE_THRESHOLD (32<<10)
+
+// The ThinLTO backend jobs follow `-linker-thread-count` when given, otherwise `-thread-count`
+gb_internal isize linker_lto_job_count(void) {
+	if (build_context.linker_thread_count > 0) {
+		return build_context.linker_thread_count;
+	}
+	return gb_max(build_context.thread_count, 1);
+}
+
+// Only splits the link section up into its phases with `-show-more-timings`
+gb_internal void linker_time_sub_section(String const &section_name, char const *phase) {
+	if (!build_context.show_more_timings) {
+		return;
+	}
+	String label = concatenate3_strings(permanent_allocator(), section_name, str_lit(" - "), make_string_c(phase));
+	debugf("[Section] %.*s\n", LIT(label));
+	timings_start_section(&global_timings, label);
+}
+
+// Returns either `object_files` unchanged, or `"@<path>"` of a response file containing them
+// if the command line would be too long, e.g. `-use-separate-modules` with thousands of objects.
+gb_internal gbString linker_object_files_or_response_file(LinkerData *ld, gbString object_files) {
+	if (build_context.print_linker_flags) {
+		return object_files;
+	}
+	if (gb_string_length(object_files) < LINKER_RESPONSE_FILE_THRESHOLD) {
+		return object_files;
+	}
+
+	String rsp_path = concatenate_strings(permanent_allocator(), ld->output_base, str_lit("-objects.rsp"));
+	char const *rsp_path_c = alloc_cstring(temporary_allocator(), rsp_path);
+
+	gbFile f = {};
+	gbFileError err = gb_file_open_mode(&f, gbFileMode_Write, rsp_path_c);
+	if (err != gbFileError_None) {
+		debugf("Failed to create linker response file %s, passing the objects on the command line\n", rsp_path_c);
+		return object_files;
+	}
+	defer (gb_file_close(&f));
+
+	isize len = gb_string_length(object_files);
+	if (!gb_file_write(&f, object_files, len)) {
+		debugf("Failed to write linker response file %s, passing the objects on the command line\n", rsp_path_c);
+		return object_files;
+	}
+	gb_file_truncate(&f, len);
+
+	array_add(&ld->output_temp_paths, rsp_path);
+
+	gb_string_clear(object_files);
+	return gb_string_append_fmt(object_files, "\"@%.*s\" ", LIT(rsp_path));
+}
+
 gb_internal void linker_data_init(LinkerData *ld, CheckerInfo *info, String const &init_fullpath) {
 	gbAllocator ha = heap_allocator();
 	array_init(&ld->output_object_paths, ha);
@@ -96,6 +151,10 @@ gb_internal i32 linker_stage(LinkerData *gen) {
 			}
 		}
 
+		if (build_context.linker_thread_count > 0) {
+			lib_str = gb_string_append_fmt(lib_str, " --threads=%td", build_context.linker_thread_count);
+		}
+
 		if (build_context.metrics.os == TargetOs_orca) {
 			gbString orca_sdk_path = gb_string_make(temporary_allocator(), "");
 			if (!system_exec_command_line_app_output("orca sdk-path", &orca_sdk_path)) {
@@ -179,6 +238,7 @@ try_cross_linking:;
 
 		if (is_windows) {
 			timings_start_section(timings, section_name);
+			linker_time_sub_section(section_name, "collect inputs");
 
 			gbString lib_str = gb_string_make(heap_allocator(), "");
 			defer (gb_string_free(lib_str));
@@ -307,11 +367,16 @@ try_cross_linking:;
 				link_settings = gb_string_append_fmt(link_settings, " /DEBUG");
 			}
 
+			linker_time_sub_section(section_name, "build command");
+
 			gbString object_files = gb_string_make(heap_allocator(), "");
 			defer (gb_string_free(object_files));
 			for (String const &object_path : gen->output_object_paths) {
 				object_files = gb_string_append_fmt(object_files, "\"%.*s\" ", LIT(object_path));
 			}
+			if (build_context.linker_choice != Linker_radlink) {
+				object_files = linker_object_files_or_response_file(gen, object_files);
+			}
 
 			String vs_exe_path = path_to_string(heap_allocator(), build_context.build_paths[BuildPath_VS_EXE]);
 			defer (gb_free(heap_allocator(), vs_exe_path.text));
@@ -322,9 +387,14 @@ try_cross_linking:;
 			gbString lld_lto_flags = gb_string_make(heap_allocator(), "");
 			defer (gb_string_free(lld_lto_flags));
 			if (build_context.lto_kind != LTO_None) {
-				lld_lto_flags = gb_string_append_fmt(lld_lto_flags, "/opt:lldltojobs=%d ", build_context.thread_count);
+				lld_lto_flags = gb_string_append_fmt(lld_lto_flags, "/opt:lldltojobs=%td ", linker_lto_job_count());
+			}
+			if (build_context.linker_thread_count > 0) {
+				lld_lto_flags = gb_string_append_fmt(lld_lto_flags, "/threads:%td ", build_context.linker_thread_count);
 			}
 
+			linker_time_sub_section(section_name, "run linker");
+
 			switch (build_context.linker_choice) {
 			case Linker_lld:
 				result = system_exec_command_line_app("msvc-lld-link",
@@ -435,6 +505,7 @@ try_cross_linking:;
 		} else {
 
 			timings_start_section(timings, section_name);
+			linker_time_sub_section(section_name, "collect inputs");
 
 			int const ODIN_ANDROID_API_LEVEL = build_context.ODIN_ANDROID_API_LEVEL;
 
@@ -739,10 +810,11 @@ try_cross_linking:;
 			}
 
 
+			linker_time_sub_section(section_name, "build command");
+
 			for (String object_path : gen->output_object_paths) {
 				object_files = gb_string_append_fmt(object_files, "\"%.*s\" ", LIT(object_path));
 			}
-
 			gbString link_settings = gb_string_make_reserve(heap_allocator(), 32);
 
 			if (build_context.no_crt) {
@@ -767,6 +839,9 @@ try_cross_linking:;
 				return result;
 			}
 
+			// NOTE: only the linker gets the response file, `ar` on macOS and the BSDs cannot expand `@file`
+			object_files = linker_object_files_or_response_file(gen, object_files);
+
 			// NOTE(dweiler): We use clang as a frontend for the linker as there are
 			// other runtime and compiler support libraries that need to be linked in
 			// very specific orders such as libgcc_s, ld-linux-so, unwind, etc.
@@ -992,7 +1067,7 @@ try_cross_linking:;
 
 			if (build_context.lto_kind != LTO_None) {
 				link_command_line = gb_string_appendc(link_command_line, " -flto=thin");
-				link_command_line = gb_string_append_fmt(link_command_line, " -flto-jobs=%d ", build_context.thread_count);
+				link_command_line = gb_string_append_fmt(link_command_line, " -flto-jobs=%td ", linker_lto_job_count());
 
 				if (build_context.ODIN_DEBUG) {
 					link_command_line = gb_string_appendc(link_command_line, " -g ");
@@ -1014,13 +1089,21 @@ try_cross_linking:;
 
 			if (is_android) {
 				TIME_SECTION("Linking");
+			} else {
+				linker_time_sub_section(section_name, "run linker");
 			}
 
 			if (build_context.linker_choice == Linker_lld) {
 				link_command_line = gb_string_append_fmt(link_command_line, " -fuse-ld=lld");
+				if (build_context.linker_thread_count > 0) {
+					link_command_line = gb_string_append_fmt(link_command_line, " -Wl,--threads=%td", build_context.linker_thread_count);
+				}
 				result = system_exec_command_line_app("lld-link", link_command_line);
 			} else if (build_context.linker_choice == Linker_mold) {
 				link_command_line = gb_string_append_fmt(link_command_line, " -fuse-ld=mold");
+				if (build_context.linker_thread_count > 0) {
+					link_command_line = gb_string_append_fmt(link_command_line, " -Wl,--thread-count=%td", build_context.linker_thread_count);
+				}
 				result = system_exec_command_line_app("mold-link", link_command_line);
 			} else {
 				result = system_exec_command_line_app("ld-link", link_command_line);
@@ -259,6 +259,61 @@ gb_internal String lb_internal_gen_name_from_type(char const *prefix, Type *type
 	return proc_name;
 }
 
+// NOTE: Types for which byte equality is exactly value equality: only simple compare leaves (no floats) and no
+// padding anywhere, so the generated equality procedure can compare the whole value at once
+gb_internal bool lb_type_is_memory_comparable(Type *t) {
+	t = core_type(t);
+	switch (t->kind) {
+	case Type_Basic:
+		return (t->Basic.flags & BasicFlag_SimpleCompare) != 0 || t->Basic.kind == Basic_typeid;
+	case Type_Pointer:
+	case Type_MultiPointer:
+	case Type_Proc:
+	case Type_BitSet:
+	case Type_BitField:
+		return true;
+	case Type_Array:
+		return lb_type_is_memory_comparable(t->Array.elem);
+	case Type_EnumeratedArray:
+		return lb_type_is_memory_comparable(t->EnumeratedArray.elem);
+	case Type_SimdVector:
+		return lb_type_is_memory_comparable(t->SimdVector.elem);
+	case Type_Struct:
+		{
+			if (t->Struct.is_raw_union) {
+				return false;
+			}
+			type_set_offsets(t);
+			i64 fields_size = 0;
+			for (Entity *f : t->Struct.fields) {
+				if (!lb_type_is_memory_comparable(f->type)) {
+					return false;
+				}
+				fields_size += type_size_of(f->type);
+			}
+			return fields_size == type_size_of(t);
+		}
+	}
+	return false;
+}
+
+// NOTE: Up to this size the comparison is done with inline wide loads, which LLVM can turn into vector compares
+#define LB_INLINE_MEMORY_EQUAL_MAX_SIZE 64
+
+gb_internal lbValue lb_emit_memory_equal_of_type(lbProcedure *p, lbValue lhs, lbValue rhs, Type *type) {
+	i64 size = type_size_of(type);
+	if (size > LB_INLINE_MEMORY_EQUAL_MAX_SIZE) {
+		auto args = array_make<lbValue>(temporary_allocator(), 3);
+		args[0] = lb_emit_conv(p, lhs, t_rawptr);
+		args[1] = lb_emit_conv(p, rhs, t_rawptr);
+		args[2] = lb_const_int(p->module, t_int, size);
+		return lb_emit_conv(p, lb_emit_runtime_call(p, "memory_equal", args), t_bool);
+	}
+
+	lbValue res = lb_emit_inline_memory_equal(p, lhs, rhs, nullptr, size, type_align_of(type));
+	return lb_emit_conv(p, res, t_bool);
+}
+
 gb_internal void lb_equal_proc_generate_body(lbModule *m, lbProcedure *p) {
 	Type *type = p->internal_gen_type;
 
@@ -291,7 +346,11 @@ gb_internal void lb_equal_proc_generate_body(lbModule *m, lbProcedure *p) {
 
 	lb_start_block(p, block_diff_ptr);
 
-	if (type->kind == Type_Struct) {
+	if (type->kind == Type_Struct && type_size_of(type) > 0 && lb_type_is_memory_comparable(type)) {
+		TEMPORARY_ALLOCATOR_GUARD();
+		lbValue ok = lb_emit_memory_equal_of_type(p, lhs, rhs, type);
+		LLVMBuildRet(p->builder, ok.value);
+	} else if (type->kind == Type_Struct) {
 		type_set_offsets(type);
 
 		lbBlock *block_false = lb_create_block(p, "bfalse");
@@ -417,11 +476,96 @@ gb_internal lbValue lb_equal_proc_for_type(lbModule *m, Type *type) {
 	return {p->value, p->type};
 }
 
+// NOTE: Simple compare keys up to this size are hashed inline rather than through `runtime.default_hasher`,
+// which walks the key a byte at a time. The result must obey the same rules: the top bit is masked off and
+// zero is never returned.
+#define LB_INLINE_HASH_MAX_SIZE 32
+
+gb_internal LLVMValueRef lb_inline_hash_load(lbProcedure *p, lbValue data, i64 offset, i64 width, i64 align) {
+	LLVMTypeRef i64_type = LLVMInt64TypeInContext(p->module->ctx);
+	LLVMTypeRef int_type = LLVMIntTypeInContext(p->module->ctx, cast(unsigned)(8*width));
+
+	while (align > 1 && (offset % align) != 0) {
+		align /= 2;
+	}
+	align = gb_min(align, width);
+
+	lbValue ptr = lb_emit_ptr_offset(p, data, lb_const_int(p->module, t_int, offset));
+	LLVMValueRef v = OdinLLVMBuildLoadAligned(p, int_type, ptr.value, align);
+	if (width < 8) {
+		v = LLVMBuildZExt(p->builder, v, i64_type, "");
+	}
+	return v;
+}
+
+gb_internal lbValue lb_inline_simple_compare_hash(lbProcedure *p, Type *type, lbValue data, lbValue seed) {
+	LLVMTypeRef i64_type = LLVMInt64TypeInContext(p->module->ctx);
+	LLVMValueRef multiplier = LLVMConstInt(i64_type, 0x9e3779b97f4a7c15ull, false);
+	LLVMValueRef finalizer  = LLVMConstInt(i64_type, 0xd6e8feb86659fd93ull, false);
+	LLVMValueRef shift      = LLVMConstInt(i64_type, 32, false);
+
+	i64 size  = type_size_of(type);
+	i64 align = type_align_of(type);
+	data = lb_emit_conv(p, data, t_u8_ptr);
+
+	LLVMValueRef h = lb_emit_conv(p, seed, t_u64).value;
+	h = LLVMBuildAdd(p->builder, h, LLVMConstInt(i64_type, 0xcbf29ce484222325ull, false), "");
+
+	auto mix = [&](LLVMValueRef word) {
+		h = LLVMBuildXor(p->builder, h, word, "");
+		h = LLVMBuildMul(p->builder, h, multiplier, "");
+	};
+
+	i64 offset = 0;
+	for (/**/; offset+8 <= size; offset += 8) {
+		mix(lb_inline_hash_load(p, data, offset, 8, align));
+	}
+	if (offset < size) {
+		// Pack the remaining 1..7 bytes into a single word
+		LLVMValueRef tail = nullptr;
+		for (i64 width = 4; width >= 1; width /= 2) {
+			if (offset+width > size) {
+				continue;
+			}
+			LLVMValueRef v = lb_inline_hash_load(p, data, offset, width, align);
+			if (tail == nullptr) {
+				tail = v;
+			} else {
+				v = LLVMBuildShl(p->builder, v, LLVMConstInt(i64_type, 8*(offset % 8), false), "");
+				tail = LLVMBuildOr(p->builder, tail, v, "");
+			}
+			offset += width;
+		}
+		GB_ASSERT(offset == size);
+		mix(tail);
+	}
+
+	h = LLVMBuildXor(p->builder, h, LLVMBuildLShr(p->builder, h, shift, ""), "");
+	h = LLVMBuildMul(p->builder, h, finalizer, "");
+	h = LLVMBuildXor(p->builder, h, LLVMBuildLShr(p->builder, h, shift, ""), "");
+
+	LLVMTypeRef uintptr_type = lb_type(p->module, t_uintptr);
+	i64 uintptr_size = type_size_of(t_uintptr);
+	if (uintptr_size < 8) {
+		h = LLVMBuildTrunc(p->builder, h, uintptr_type, "");
+	}
+	u64 hash_mask = (1ull << (8*uintptr_size - 1)) - 1;
+	h = LLVMBuildAnd(p->builder, h, LLVMConstInt(uintptr_type, hash_mask, false), "");
+	LLVMValueRef is_zero = LLVMBuildICmp(p->builder, LLVMIntEQ, h, LLVMConstNull(uintptr_type), "");
+	h = LLVMBuildOr(p->builder, h, LLVMBuildZExt(p->builder, is_zero, uintptr_type, ""), "");
+
+	return {h, t_uintptr};
+}
+
 gb_internal lbValue lb_simple_compare_hash(lbProcedure *p, Type *type, lbValue data, lbValue seed) {
 	TEMPORARY_ALLOCATOR_GUARD();
 
 	GB_ASSERT_MSG(is_type_simple_compare(type), "%s", type_to_string(type));
 
+	if (type_size_of(type) <= LB_INLINE_HASH_MAX_SIZE) {
+		return lb_inline_simple_compare_hash(p, type, data, seed);
+	}
+
 	auto args = array_make<lbValue>(temporary_allocator(), 3);
 	args[0] = data;
 	args[1] = seed;
@@ -465,7 +609,9 @@ gb_internal lbValue lb_hasher_proc_for_type(lbModule *m, Type *type) {
 
 	if (is_type_simple_compare(type)) {
 		lbValue res = lb_simple_compare_hash(p, type, data, seed);
-		lb_add_callsite_force_inline(p, res);
+		if (LLVMIsACallInst(res.value)) {
+			lb_add_callsite_force_inline(p, res);
+		}
 		LLVMBuildRet(p->builder, res.value);
 		return {p->value, p->type};
 	}
@@ -644,6 +790,20 @@ gb_internal lbValue lb_hasher_proc_for_type(lbModule *m, Type *type) {
 #define LLVM_SET_VALUE_NAME(value, name) LLVMSetValueName2((value), (name), gb_count_of((name))-1);
 
 
+// NOTE: The generated map lookup scans this many hashes at once with vector compares when the probe does not
+// wrap around the end of the hash array. The runtime layout and Robin Hood probing rules are unchanged.
+gb_internal i64 lb_map_group_probe_size(void) {
+	if (build_context.metrics.ptr_size != 8) {
+		return 0;
+	}
+	switch (build_context.metrics.arch) {
+	case TargetArch_amd64:
+	case TargetArch_arm64:
+		return 4;
+	}
+	return 0;
+}
+
 gb_internal lbValue lb_map_get_proc_for_type(lbModule *m, Type *type) {
 	GB_ASSERT(!build_context.dynamic_map_calls);
 	type = base_type(type);
@@ -746,6 +906,122 @@ gb_internal lbValue lb_map_get_proc_for_type(lbModule *m, Type *type) {
 	lb_emit_jump(p, loop_block);
 	lb_start_block(p, loop_block);
 
+	i64 group_size = lb_map_group_probe_size();
+	if (group_size > 0) {
+		lbBlock *group_block       = lb_create_block(p, "group");
+		lbBlock *group_match_block = lb_create_block(p, "group_match");
+		lbBlock *group_key_block   = lb_create_block(p, "group_key");
+		lbBlock *group_value_block = lb_create_block(p, "group_value");
+		lbBlock *group_next_block  = lb_create_block(p, "group_next");
+		lbBlock *scalar_block      = lb_create_block(p, "scalar");
+
+		LLVMTypeRef uintptr_type = lb_type(m, t_uintptr);
+		LLVMTypeRef vector_type  = LLVMVectorType(uintptr_type, cast(unsigned)group_size);
+		LLVMTypeRef bits_type    = LLVMIntTypeInContext(m->ctx, cast(unsigned)group_size);
+		lbValue group_size_uintptr = lb_const_int(m, t_uintptr, group_size);
+		lbValue cap = lb_emit_conv(p, capacity, t_uintptr);
+
+		auto splat = [&](LLVMValueRef v) -> LLVMValueRef {
+			LLVMValueRef undef = LLVMGetUndef(vector_type);
+			LLVMValueRef first = LLVMBuildInsertElement(p->builder, undef, v, LLVMConstInt(LLVMInt32TypeInContext(m->ctx), 0, false), "");
+			return LLVMBuildShuffleVector(p->builder, first, undef, LLVMConstNull(LLVMVectorType(LLVMInt32TypeInContext(m->ctx), cast(unsigned)group_size)), "");
+		};
+		auto to_bits = [&](LLVMValueRef cmp) -> lbValue {
+			LLVMValueRef bits = LLVMBuildBitCast(p->builder, cmp, bits_type, "");
+			return {LLVMBuildZExt(p->builder, bits, lb_type(m, t_u32), ""), t_u32};
+		};
+
+		// Only take the group path when the whole group lies before the end of the hash array
+		lbValue group_end = lb_emit_arith(p, Token_Add, lb_addr_load(p, pos), group_size_uintptr, t_uintptr);
+		lb_emit_if(p, lb_emit_comp(p, Token_LtEq, group_end, cap), group_block, scalar_block);
+
+		lb_start_block(p, group_block);
+
+		lbValue group_pos = lb_addr_load(p, pos);
+		LLVM_SET_VALUE_NAME(group_pos.value, "group_pos");
+		lbValue group_hashes_ptr = lb_emit_ptr_offset(p, hs, group_pos);
+		LLVMValueRef group_hashes = OdinLLVMBuildLoadAligned(p, vector_type, group_hashes_ptr.value, type_align_of(t_uintptr));
+		LLVM_SET_VALUE_NAME(group_hashes, "group_hashes");
+
+		auto lane_values = slice_make<LLVMValueRef>(temporary_allocator(), group_size);
+		for (i64 i = 0; i < group_size; i++) {
+			lane_values[i] = LLVMConstInt(uintptr_type, cast(unsigned long long)i, false);
+		}
+		LLVMValueRef lanes = LLVMConstVector(lane_values.data, cast(unsigned)group_size);
+
+		// The probe stops at the first empty slot, or at the first slot whose occupant is closer to its
+		// desired position than the key would be (map_probe_distance inlined per lane)
+		LLVMValueRef slots = LLVMBuildAdd(p->builder, splat(group_pos.value), lanes, "");
+		LLVMValueRef desired = LLVMBuildAnd(p->builder, group_hashes, splat(mask.value), "");
+		LLVMValueRef probe_distances = LLVMBuildSub(p->builder, LLVMBuildAdd(p->builder, slots, splat(cap.value), ""), desired, "");
+		probe_distances = LLVMBuildAnd(p->builder, probe_distances, splat(mask.value), "");
+		LLVMValueRef distances = LLVMBuildAdd(p->builder, splat(lb_addr_load(p, distance).value), lanes, "");
+
+		LLVMValueRef is_empty = LLVMBuildICmp(p->builder, LLVMIntEQ, group_hashes, LLVMConstNull(vector_type), "");
+		LLVMValueRef is_past  = LLVMBuildICmp(p->builder, LLVMIntUGT, distances, probe_distances, "");
+		lbValue stop_bits = to_bits(LLVMBuildOr(p->builder, is_empty, is_past, ""));
+		stop_bits = lb_emit_arith(p, Token_Or, stop_bits, lb_const_int(m, t_u32, 1ull<<group_size), t_u32);
+		lbValue first_stop = lb_emit_count_trailing_zeros(p, stop_bits, t_u32);
+		LLVM_SET_VALUE_NAME(first_stop.value, "first_stop");
+
+		// Only hashes before the stop are candidates, matching the scalar loop's order of checks
+		lbValue match_bits = to_bits(LLVMBuildICmp(p->builder, LLVMIntEQ, group_hashes, splat(h.value), ""));
+		lbValue before_stop = lb_emit_arith(p, Token_Shl, lb_const_int(m, t_u32, 1), first_stop, t_u32);
+		before_stop = lb_emit_arith(p, Token_Sub, before_stop, lb_const_int(m, t_u32, 1), t_u32);
+		match_bits = lb_emit_arith(p, Token_And, match_bits, before_stop, t_u32);
+
+		lbAddr matches = lb_add_local_generated(p, t_u32, false);
+		LLVM_SET_VALUE_NAME(matches.addr.value, "matches");
+		lb_addr_store(p, matches, match_bits);
+		lb_emit_jump(p, group_match_block);
+
+		lb_start_block(p, group_match_block);
+		{
+			lbValue remaining = lb_addr_load(p, matches);
+			lb_emit_if(p, lb_emit_comp(p, Token_CmpEq, remaining, lb_const_int(m, t_u32, 0)), group_next_block, group_key_block);
+		}
+
+		lb_start_block(p, group_key_block);
+		lbValue group_index = {};
+		{
+			lbValue remaining = lb_addr_load(p, matches);
+			lbValue lane = lb_emit_count_trailing_zeros(p, remaining, t_u32);
+			lbValue rest = lb_emit_arith(p, Token_Sub, remaining, lb_const_int(m, t_u32, 1), t_u32);
+			lb_addr_store(p, matches, lb_emit_arith(p, Token_And, remaining, rest, t_u32));
+
+			group_index = lb_emit_arith(p, Token_Add, group_pos, lb_emit_conv(p, lane, t_uintptr), t_uintptr);
+			LLVM_SET_VALUE_NAME(group_index.value, "group_index");
+
+			lbValue element_key = lb_map_cell_index_static(p, type->Map.key, ks, group_index);
+			element_key = lb_emit_conv(p, element_key, ks.type);
+			lbValue cond = lb_emit_comp(p, Token_CmpEq, lb_emit_load(p, element_key), key);
+			lb_emit_if(p, cond, group_value_block, group_match_block);
+		}
+
+		lb_start_block(p, group_value_block);
+		{
+			lbValue element_value = lb_map_cell_index_static(p, type->Map.value, vs, group_index);
+			element_value = lb_emit_conv(p, element_value, t_rawptr);
+			LLVMBuildRet(p->builder, element_value.value);
+		}
+
+		lb_start_block(p, group_next_block);
+		{
+			lbValue stopped = lb_emit_comp(p, Token_Lt, first_stop, lb_const_int(m, t_u32, group_size));
+			lbBlock *advance_block = lb_create_block(p, "group_advance");
+			lb_emit_if(p, stopped, nil_block, advance_block);
+
+			lb_start_block(p, advance_block);
+			lbValue next_pos = lb_emit_arith(p, Token_Add, group_pos, group_size_uintptr, t_uintptr);
+			lb_addr_store(p, pos, lb_emit_arith(p, Token_And, next_pos, mask, t_uintptr));
+			lbValue next_distance = lb_emit_arith(p, Token_Add, lb_addr_load(p, distance), group_size_uintptr, t_uintptr);
+			lb_addr_store(p, distance, next_distance);
+			lb_emit_jump(p, loop_block);
+		}
+
+		lb_start_block(p, scalar_block);
+	}
+
 	lbValue element_hash = lb_emit_load(p, lb_emit_ptr_offset(p, hs, lb_addr_load(p, pos)));
 	LLVM_SET_VALUE_NAME(element_hash.value, "element_hash");
 
@@ -756,8 +1032,8 @@ gb_internal lbValue lb_map_get_proc_for_type(lbModule *m, Type *type) {
 
 	lb_start_block(p, probe_block);
 	{
-		// map_probe_distance inlined
-		lbValue probe_distance = lb_emit_arith(p, Token_And, h, mask, t_uintptr);
+		// map_probe_distance inlined, from the stored hash as in the group path and the runtime's map_lookup_dynamic
+		lbValue probe_distance = lb_emit_arith(p, Token_And, element_hash, mask, t_uintptr);
 		probe_distance = lb_emit_conv(p, probe_distance, t_uintptr);
 
 		lbValue cap = lb_emit_conv(p, capacity, t_uintptr);
@@ -2067,7 +2343,7 @@ gb_internal bool lb_init_global_var(lbModule *m, lbProcedure *p, Entity *e, Ast
 		Type *t = type_deref(var.var.type);
 
 		// NOTE: 'any' literals or 'any's that point to other variables can be handled by the generic path
-		if (is_type_any(t) && !is_type_any(var.init.type) && init_expr->tav.mode != Addressing_Variable) {
+		if (is_type_any(t) && !is_type_any(var.init.type) && init_expr->tav().mode != Addressing_Variable) {
 			// NOTE(bill): Edge case for 'any' type
 			Type *var_type = default_type(var.init.type);
 			gbString var_name = gb_string_make(permanent_allocator(), "__$global_any::");
@@ -2365,6 +2641,97 @@ gb_internal bool lb_is_module_empty(lbModule *m) {
 	return true;
 }
 
+struct lbObjectWrite {
+	String              filepath;
+	LLVMMemoryBufferRef buffer;
+};
+
+// NOTE: Codegen emits into memory buffers which are queued here rather than writing the files
+// itself. Whichever emit worker finds the writer idle becomes the writer and drains the whole
+// queue in one batch, so the other workers never stall on (slow or network-backed) file writes.
+struct lbObjectWriter {
+	BlockingMutex           mutex;
+	Array<lbObjectWrite>    pending;
+	std::atomic<bool>       writing;
+	std::atomic<bool>       failed;
+};
+
+gb_global lbObjectWriter lb_object_writer;
+
+gb_internal bool lb_write_memory_buffer_to_file(LLVMMemoryBufferRef buffer, String const &filepath) {
+	char const *data = LLVMGetBufferStart(buffer);
+	isize size = cast(isize)LLVMGetBufferSize(buffer);
+
+	gbFile f = {};
+	if (gb_file_open_mode(&f, gbFileMode_Write, cast(char const *)filepath.text) != gbFileError_None) {
+		return false;
+	}
+	defer (gb_file_close(&f));
+
+	isize offset = 0;
+	while (offset < size) {
+		isize written = 0;
+		if (!gb_file_write_at_check(&f, data+offset, size-offset, offset, &written) || written <= 0) {
+			return false;
+		}
+		offset += written;
+	}
+	return true;
+}
+
+gb_internal bool lb_object_writer_has_pending(lbObjectWriter *w) {
+	MUTEX_GUARD(&w->mutex);
+	return w->pending.count != 0;
+}
+
+gb_internal void lb_object_writer_flush(lbObjectWriter *w) {
+	for (;;) {
+		bool expected = false;
+		if (!w->writing.compare_exchange_strong(expected, true)) {
+			// NOTE: the current writer rechecks the queue before it gives up the role
+			return;
+		}
+
+		for (;;) {
+			Array<lbObjectWrite> batch = {};
+			mutex_lock(&w->mutex);
+			batch = w->pending;
+			w->pending = {};
+			mutex_unlock(&w->mutex);
+
+			if (batch.count == 0) {
+				break;
+			}
+			for (lbObjectWrite const &ow : batch) {
+				if (!lb_write_memory_buffer_to_file(ow.buffer, ow.filepath)) {
+					gb_printf_err("Failed to write object file: %.*s\n", LIT(ow.filepath));
+					w->failed.store(true);
+				} else {
+					debugf("Generated File: %.*s\n", LIT(ow.filepath));
+				}
+				LLVMDisposeMemoryBuffer(ow.buffer);
+			}
+			array_free(&batch);
+		}
+
+		w->writing.store(false);
+		if (!lb_object_writer_has_pending(w)) {
+			return;
+		}
+	}
+}
+
+gb_internal void lb_object_writer_push(lbObjectWriter *w, String const &filepath, LLVMMemoryBufferRef buffer) {
+	mutex_lock(&w->mutex);
+	if (w->pending.allocator.proc == nullptr) {
+		array_init(&w->pending, heap_allocator());
+	}
+	array_add(&w->pending, lbObjectWrite{filepath, buffer});
+	mutex_unlock(&w->mutex);
+
+	lb_object_writer_flush(w);
+}
+
 struct lbLLVMEmitWorker {
 	LLVMTargetMachineRef target_machine;
 	LLVMCodeGenFileType code_gen_file_type;
@@ -2379,16 +2746,18 @@ gb_internal WORKER_TASK_PROC(lb_llvm_emit_worker_proc) {
 
 	auto wd = cast(lbLLVMEmitWorker *)data;
 
+	LLVMMemoryBufferRef buffer = nullptr;
 	if (build_context.lto_kind != LTO_None) {
-		if (LLVMWriteBitcodeToFile(wd->m->mod, cast(char *)wd->filepath_obj.text)) {
+		buffer = LLVMWriteBitcodeToMemoryBuffer(wd->m->mod);
+		if (buffer == nullptr) {
 			gb_printf_err("Failed to write bitcode file: %.*s\n", LIT(wd->filepath_obj));
 			exit_with_errors();
 		}
-	} else if (LLVMTargetMachineEmitToFile(wd->target_machine, wd->m->mod, cast(char *)wd->filepath_obj.text, wd->code_gen_file_type, &llvm_error)) {
+	} else if (LLVMTargetMachineEmitToMemoryBuffer(wd->target_machine, wd->m->mod, wd->code_gen_file_type, &llvm_error, &buffer)) {
 		gb_printf_err("LLVM Error: %s\n", llvm_error);
 		exit_with_errors();
 	}
-	debugf("Generated File: %.*s\n", LIT(wd->filepath_obj));
+	lb_object_writer_push(&lb_object_writer, wd->filepath_obj, buffer);
 	return 0;
 }
 
@@ -2487,6 +2856,14 @@ gb_internal WORKER_TASK_PROC(lb_llvm_module_pass_worker_proc) {
 	LLVMPassBuilderOptionsRef pb_options = LLVMCreatePassBuilderOptions();
 	defer (LLVMDisposePassBuilderOptions(pb_options));
 
+	// NOTE: the profile is matched against a hash of each function's CFG, so instrumentation and
+	// profile use must both happen at the very same point: before any optimizations
+	if (build_context.pgo_instrument) {
+		array_add(&passes, "pgo-instr-gen");
+	} else if (build_context.pgo_use_path.len != 0) {
+		array_add(&passes, "pgo-instr-use");
+	}
+
 	#include "llvm_backend_passes.cpp"
 
 	// asan - Linux, Darwin, Windows
@@ -2511,6 +2888,11 @@ gb_internal WORKER_TASK_PROC(lb_llvm_module_pass_worker_proc) {
 		}
 	}
 
+	if (build_context.pgo_instrument) {
+		// NOTE: lowers the counter intrinsics after optimization so they do not get in its way
+		array_add(&passes, "instrprof");
+	}
+
 	if (passes.count == 0) {
 		array_add(&passes, "verify");
 	}
@@ -2822,6 +3204,12 @@ gb_internal bool lb_llvm_object_generation(lbGenerator *gen, bool do_threading)
 		}
 
 		thread_pool_wait(&global_thread_pool);
+
+		lb_object_writer_flush(&lb_object_writer);
+		if (lb_object_writer.failed.load()) {
+			exit_with_errors();
+			return false;
+		}
 	} else {
 		for (auto const &entry : gen->modules) {
 			lbModule *m = entry.value;
@@ -3115,6 +3503,27 @@ gb_internal bool lb_generate_code(lbGenerator *gen) {
 		LLVMInitializeNativeTarget();
 	}
 
+	auto llvm_args = array_make<char const *>(heap_allocator(), 0, 8);
+	defer (array_free(&llvm_args));
+	array_add(&llvm_args, "odin");
+
+	if (build_context.pgo_use_path.len != 0) {
+		// NOTE: `pgo-instr-use` in a textual pipeline takes its profile from this option
+		char const *profile_arg = alloc_cstring(permanent_allocator(),
+			concatenate_strings(permanent_allocator(), str_lit("-pgo-test-profile-file="), build_context.pgo_use_path));
+		array_add(&llvm_args, profile_arg);
+	}
+	if (build_context.optimization_remarks_filter.len != 0) {
+		// NOTE: Passed (done), missed (not done), and analysis (why not) remarks
+		String filter = build_context.optimization_remarks_filter;
+		array_add(&llvm_args, alloc_cstring(permanent_allocator(), concatenate_strings(permanent_allocator(), str_lit("-pass-remarks="), filter)));
+		array_add(&llvm_args, alloc_cstring(permanent_allocator(), concatenate_strings(permanent_allocator(), str_lit("-pass-remarks-missed="), filter)));
+		array_add(&llvm_args, alloc_cstring(permanent_allocator(), concatenate_strings(permanent_allocator(), str_lit("-pass-remarks-analysis="), filter)));
+	}
+	if (llvm_args.count > 1) {
+		LLVMParseCommandLineOptions(cast(int)llvm_args.count, llvm_args.data, nullptr);
+	}
+
 	char const *target_triple = alloc_cstring(permanent_allocator(), build_context.metrics.target_triplet);
 	for (auto const &entry : gen->modules) {
 		LLVMSetTarget(entry.value->mod, target_triple);
@@ -3701,6 +4110,11 @@ gb_internal bool lb_generate_code(lbGenerator *gen) {
 	TIME_SECTION("LLVM Function Pass");
 	lb_llvm_function_passes(gen, do_threading && !build_context.ODIN_DEBUG);
 
+	if (!build_context.ODIN_DEBUG) {
+		TIME_SECTION("LLVM Elide Unused Context");
+		lb_run_elide_unused_context_pass(gen);
+	}
+
 	TIME_SECTION("LLVM Remove Unused Functions and Globals");
 	lb_remove_unused_functions_and_globals(gen);
 
@@ -3810,6 +4224,15 @@ gb_internal bool lb_generate_code(lbGenerator *gen) {
 		}
 	}
 
+	if (build_context.pgo_instrument) {
+		// NOTE: the clang driver adds the profile runtime
+		if (!build_context.extra_linker_flags.text) {
+			build_context.extra_linker_flags = str_lit("-fprofile-instr-generate");
+		} else {
+			build_context.extra_linker_flags = concatenate_strings(permanent_allocator(), build_context.extra_linker_flags, str_lit(" -fprofile-instr-generate"));
+		}
+	}
+
 	array_sort(gen->foreign_libraries, foreign_library_cmp);
 
 	return true;
@@ -15,6 +15,7 @@
 #include <llvm-c/Object.h>
 #include <llvm-c/BitWriter.h>
 #include <llvm-c/DebugInfo.h>
+#include <llvm-c/Support.h>
 #include <llvm-c/Transforms/PassBuilder.h>
 
 
@@ -295,6 +296,22 @@ struct lbVariadicReuseSlices {
 	lbAddr slice_addr;
 };
 
+// NOTE: While a range loop body is being generated, its index is known to be within these bounds
+struct lbBoundsFact {
+	Entity * index;     // immutable loop index, known to be >= 0
+	Entity * array;     // `index < len(array)`, or nullptr
+	i64      const_len; // `index < const_len`, or -1
+	Scope *  scope;     // scope of the loop
+	lbBlock *preheader; // dominates the loop, checks of other arrays are hoisted into it
+};
+
+// NOTE: `len(array) >= bound` of a fact, compared once in its preheader
+struct lbBoundsGuard {
+	Entity *index;
+	Entity *array;
+	lbValue in_range;
+};
+
 struct lbGlobalVariable {
 	lbValue var;
 	lbValue init;
@@ -367,6 +384,11 @@ struct lbProcedure {
 	PtrMap<LLVMValueRef, lbTupleFix> tuple_fix_map;
 
 	Array<lbValue> asan_stack_locals;
+	Array<lbBoundsFact> bounds_facts;
+	Array<lbBoundsGuard> bounds_guards;
+
+	PtrSet<Ast *> stack_make_calls;   // `make([]T, N)` calls whose slice never escapes, backed by a stack array
+	PtrSet<Ast *> stack_delete_calls; // `delete(s)` calls of those slices
 
 	void (*generate_body)(lbModule *m, lbProcedure *p);
 	Array<lbGlobalVariable> *global_variables;
@@ -487,6 +509,7 @@ gb_internal lbValue lb_emit_runtime_call(lbProcedure *p, char const *c_name, Arr
 
 
 gb_internal lbValue lb_emit_ptr_offset(lbProcedure *p, lbValue ptr, lbValue index);
+gb_internal lbValue lb_emit_memory_equal_of_type(lbProcedure *p, lbValue lhs, lbValue rhs, Type *type);
 gb_internal lbValue lb_const_ptr_offset(lbModule *m, lbValue ptr, lbValue index);
 gb_internal lbValue lb_string_elem(lbProcedure *p, lbValue string);
 gb_internal lbValue lb_string_len(lbProcedure *p, lbValue string);
@@ -531,6 +554,7 @@ gb_internal lbValue lb_dynamic_map_reserve(lbProcedure *p, lbValue const &map_pt
 
 gb_internal lbValue lb_find_procedure_value_from_entity(lbModule *m, Entity *e);
 gb_internal lbValue lb_find_value_from_entity(lbModule *m, Entity *e);
+gb_internal lbValue lb_find_ident(lbProcedure *p, lbModule *m, Entity *e, Ast *expr);
 
 gb_internal void lb_store_type_case_implicit(lbProcedure *p, Ast *clause, lbValue value, bool is_default_case);
 gb_internal lbAddr lb_store_range_stmt_val(lbProcedure *p, Ast *stmt_val, lbValue value);
@@ -55,7 +55,7 @@ gb_internal bool lb_is_const_nil(lbValue value) {
 
 gb_internal bool lb_is_expr_constant_zero(Ast *expr) {
 	GB_ASSERT(expr != nullptr);
-	auto v = exact_value_to_integer(expr->tav.value);
+	auto v = exact_value_to_integer(expr->tav().value);
 	if (v.kind == ExactValue_Integer) {
 		return big_int_cmp_zero(&v.value_integer) == 0;
 	}
@@ -654,10 +654,10 @@ gb_internal lbValue lb_const_value_bit_field(lbModule *m, Type *type, Ast *value
 		GB_ASSERT(bit_size > 0);
 
 		Type *field_type = sel.entity->type;
-		if (fv->value->tav.mode != Addressing_Constant) {
+		if (fv->value->tav().mode != Addressing_Constant) {
 			continue;
 		}
-		lbValue field_expr = lb_const_value(m, field_type, fv->value->tav.value, field_type);
+		lbValue field_expr = lb_const_value(m, field_type, fv->value->tav().value, field_type);
 		array_add(&values, field_expr);
 		array_add(&fields, FieldData{field_type, cast(u64)bit_offset, cast(u64)bit_size});
 	}
@@ -1398,8 +1398,8 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 						ast_node(fv, FieldValue, elem);
 						if (is_ast_range(fv->field)) {
 							ast_node(ie, BinaryExpr, fv->field);
-							TypeAndValue lo_tav = ie->left->tav;
-							TypeAndValue hi_tav = ie->right->tav;
+							TypeAndValue lo_tav = ie->left->tav();
+							TypeAndValue hi_tav = ie->right->tav();
 							GB_ASSERT(lo_tav.mode == Addressing_Constant);
 							GB_ASSERT(hi_tav.mode == Addressing_Constant);
 
@@ -1410,7 +1410,7 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 								hi += 1;
 							}
 							if (lo == i) {
-								TypeAndValue tav = fv->value->tav;
+								TypeAndValue tav = fv->value->tav();
 								LLVMValueRef val = lb_const_value(m, elem_type, tav.value, tav.type, cc).value;
 								for (i64 k = lo; k < hi; k++) {
 									aos_values[value_index++] = val;
@@ -1421,11 +1421,11 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 								break;
 							}
 						} else {
-							TypeAndValue index_tav = fv->field->tav;
+							TypeAndValue index_tav = fv->field->tav();
 							GB_ASSERT(index_tav.mode == Addressing_Constant);
 							i64 index = exact_value_to_i64(index_tav.value);
 							if (index == i) {
-								TypeAndValue tav = fv->value->tav;
+								TypeAndValue tav = fv->value->tav();
 								LLVMValueRef val = lb_const_value(m, elem_type, tav.value, tav.type, cc).value;
 								aos_values[value_index++] = val;
 								found = true;
@@ -1477,7 +1477,7 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 				LLVMValueRef *aos_values = gb_alloc_array(temporary_allocator(), LLVMValueRef, elem_count);
 
 				for (isize i = 0; i < elem_count; i++) {
-					TypeAndValue tav = cl->elems[i]->tav;
+					TypeAndValue tav = cl->elems[i]->tav();
 					GB_ASSERT(tav.mode != Addressing_Invalid);
 					aos_values[i] = lb_const_value(m, elem_type, tav.value, tav.type, cc).value;
 				}
@@ -1520,7 +1520,7 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 			if (elem_count == 0 || !elem_type_can_be_constant(elem_type)) {
 				return lb_const_nil(m, original_type);
 			}
-			if (are_types_identical(value.value_compound->tav.type, elem_type)) {
+			if (are_types_identical(value.value_compound->tav().type, elem_type)) {
 				// Compound is of array item type; expand its value to all items in array.
 				LLVMValueRef* values = gb_alloc_array(temporary_allocator(), LLVMValueRef, cast(isize)type->Array.count);
 
@@ -1543,8 +1543,8 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 						ast_node(fv, FieldValue, elem);
 						if (is_ast_range(fv->field)) {
 							ast_node(ie, BinaryExpr, fv->field);
-							TypeAndValue lo_tav = ie->left->tav;
-							TypeAndValue hi_tav = ie->right->tav;
+							TypeAndValue lo_tav = ie->left->tav();
+							TypeAndValue hi_tav = ie->right->tav();
 							GB_ASSERT(lo_tav.mode == Addressing_Constant);
 							GB_ASSERT(hi_tav.mode == Addressing_Constant);
 
@@ -1555,7 +1555,7 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 								hi += 1;
 							}
 							if (lo == i) {
-								TypeAndValue tav = fv->value->tav;
+								TypeAndValue tav = fv->value->tav();
 								LLVMValueRef val = lb_const_value(m, elem_type, tav.value, tav.type, cc).value;
 								for (i64 k = lo; k < hi; k++) {
 									values[value_index++] = val;
@@ -1566,11 +1566,11 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 								break;
 							}
 						} else {
-							TypeAndValue index_tav = fv->field->tav;
+							TypeAndValue index_tav = fv->field->tav();
 							GB_ASSERT(index_tav.mode == Addressing_Constant);
 							i64 index = exact_value_to_i64(index_tav.value);
 							if (index == i) {
-								TypeAndValue tav = fv->value->tav;
+								TypeAndValue tav = fv->value->tav();
 								LLVMValueRef val = lb_const_value(m, elem_type, tav.value, tav.type, cc).value;
 								values[value_index++] = val;
 								found = true;
@@ -1594,7 +1594,7 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 
 				isize elem_index = 0;
 				for (isize i = 0; i < elem_count; i++) {
-					TypeAndValue tav = cl->elems[i]->tav;
+					TypeAndValue tav = cl->elems[i]->tav();
 					GB_ASSERT(tav.mode != Addressing_Invalid);
 					if (is_type_tuple(tav.type)) {
 						elem_index += tav.type->Tuple.variables.count;
@@ -1635,8 +1635,8 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 						ast_node(fv, FieldValue, elem);
 						if (is_ast_range(fv->field)) {
 							ast_node(ie, BinaryExpr, fv->field);
-							TypeAndValue lo_tav = ie->left->tav;
-							TypeAndValue hi_tav = ie->right->tav;
+							TypeAndValue lo_tav = ie->left->tav();
+							TypeAndValue hi_tav = ie->right->tav();
 							GB_ASSERT(lo_tav.mode == Addressing_Constant);
 							GB_ASSERT(hi_tav.mode == Addressing_Constant);
 
@@ -1647,7 +1647,7 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 								hi += 1;
 							}
 							if (lo == i) {
-								TypeAndValue tav = fv->value->tav;
+								TypeAndValue tav = fv->value->tav();
 								LLVMValueRef val = lb_const_value(m, elem_type, tav.value, tav.type, cc).value;
 								for (i64 k = lo; k < hi; k++) {
 									values[value_index++] = val;
@@ -1658,11 +1658,11 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 								break;
 							}
 						} else {
-							TypeAndValue index_tav = fv->field->tav;
+							TypeAndValue index_tav = fv->field->tav();
 							GB_ASSERT(index_tav.mode == Addressing_Constant);
 							i64 index = exact_value_to_i64(index_tav.value);
 							if (index == i) {
-								TypeAndValue tav = fv->value->tav;
+								TypeAndValue tav = fv->value->tav();
 								LLVMValueRef val = lb_const_value(m, elem_type, tav.value, tav.type, cc).value;
 								values[value_index++] = val;
 								found = true;
@@ -1686,7 +1686,7 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 
 				isize elem_index = 0;
 				for (isize i = 0; i < elem_count; i++) {
-					TypeAndValue tav = cl->elems[i]->tav;
+					TypeAndValue tav = cl->elems[i]->tav();
 					GB_ASSERT(tav.mode != Addressing_Invalid);
 					if (is_type_tuple(tav.type)) {
 						elem_index += tav.type->Tuple.variables.count;
@@ -1725,8 +1725,8 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 						ast_node(fv, FieldValue, elem);
 						if (is_ast_range(fv->field)) {
 							ast_node(ie, BinaryExpr, fv->field);
-							TypeAndValue lo_tav = ie->left->tav;
-							TypeAndValue hi_tav = ie->right->tav;
+							TypeAndValue lo_tav = ie->left->tav();
+							TypeAndValue hi_tav = ie->right->tav();
 							GB_ASSERT(lo_tav.mode == Addressing_Constant);
 							GB_ASSERT(hi_tav.mode == Addressing_Constant);
 
@@ -1739,7 +1739,7 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 							max_index = gb_max(max_index, hi-1);
 
 							if (lo == i) {
-								TypeAndValue tav = fv->value->tav;
+								TypeAndValue tav = fv->value->tav();
 								LLVMValueRef val = lb_const_value(m, elem_type, tav.value, tav.type, cc).value;
 								for (i64 k = lo; k < hi; k++) {
 									values[value_index++] = val;
@@ -1750,14 +1750,14 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 								break;
 							}
 						} else {
-							TypeAndValue index_tav = fv->field->tav;
+							TypeAndValue index_tav = fv->field->tav();
 							GB_ASSERT(index_tav.mode == Addressing_Constant);
 							i64 index = exact_value_to_i64(index_tav.value);
 
 							max_index = gb_max(max_index, index);
 
 							if (index == i) {
-								TypeAndValue tav = fv->value->tav;
+								TypeAndValue tav = fv->value->tav();
 								LLVMValueRef val = lb_const_value(m, elem_type, tav.value, tav.type, cc).value;
 								values[value_index++] = val;
 								found = true;
@@ -1777,7 +1777,7 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 
 				res.value = lb_fill_fixed_capacity_dynamic_array(m, count, original_type, values, cc);
 				return res;
-			} else if (are_types_identical(value.value_compound->tav.type, elem_type)) {
+			} else if (are_types_identical(value.value_compound->tav().type, elem_type)) {
 				// Compound is of array item type; expand its value to all items in array.
 				LLVMValueRef* values = gb_alloc_array(temporary_allocator(), LLVMValueRef, cast(isize)capacity);
 
@@ -1795,7 +1795,7 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 
 				isize elem_index = 0;
 				for (isize i = 0; i < elem_count; i++) {
-					TypeAndValue tav = cl->elems[i]->tav;
+					TypeAndValue tav = cl->elems[i]->tav();
 					GB_ASSERT(tav.mode != Addressing_Invalid);
 					if (is_type_tuple(tav.type)) {
 						elem_index += tav.type->Tuple.variables.count;
@@ -1835,8 +1835,8 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 						ast_node(fv, FieldValue, elem);
 						if (is_ast_range(fv->field)) {
 							ast_node(ie, BinaryExpr, fv->field);
-							TypeAndValue lo_tav = ie->left->tav;
-							TypeAndValue hi_tav = ie->right->tav;
+							TypeAndValue lo_tav = ie->left->tav();
+							TypeAndValue hi_tav = ie->right->tav();
 							GB_ASSERT(lo_tav.mode == Addressing_Constant);
 							GB_ASSERT(hi_tav.mode == Addressing_Constant);
 
@@ -1847,7 +1847,7 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 								hi += 1;
 							}
 							if (lo == i) {
-								TypeAndValue tav = fv->value->tav;
+								TypeAndValue tav = fv->value->tav();
 								LLVMValueRef val = lb_const_value(m, elem_type, tav.value, tav.type, cc).value;
 								for (i64 k = lo; k < hi; k++) {
 									values[value_index++] = val;
@@ -1858,11 +1858,11 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 								break;
 							}
 						} else {
-							TypeAndValue index_tav = fv->field->tav;
+							TypeAndValue index_tav = fv->field->tav();
 							GB_ASSERT(index_tav.mode == Addressing_Constant);
 							i64 index = exact_value_to_i64(index_tav.value);
 							if (index == i) {
-								TypeAndValue tav = fv->value->tav;
+								TypeAndValue tav = fv->value->tav();
 								LLVMValueRef val = lb_const_value(m, elem_type, tav.value, tav.type, cc).value;
 								values[value_index++] = val;
 								found = true;
@@ -1880,7 +1880,7 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 				return res;
 			} else {
 				for (isize i = 0; i < elem_count; i++) {
-					TypeAndValue tav = cl->elems[i]->tav;
+					TypeAndValue tav = cl->elems[i]->tav();
 					GB_ASSERT(tav.mode != Addressing_Invalid);
 					values[i] = lb_const_value(m, elem_type, tav.value, tav.type, cc).value;
 				}
@@ -1910,7 +1910,7 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 					ast_node(fv, FieldValue, cl->elems[0]);
 					Entity *f = entity_of_node(fv->field);
 
-					TypeAndValue tav = fv->value->tav;
+					TypeAndValue tav = fv->value->tav();
 					if (tav.value.kind != ExactValue_Invalid) {
 						lbValue value = lb_const_value(m, f->type, tav.value, f->type, cc);
 
@@ -1957,7 +1957,7 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 					String name = fv->field->Ident.token.string;
 					InternedString interned = fv->field->Ident.interned;
 
-					TypeAndValue tav = fv->value->tav;
+					TypeAndValue tav = fv->value->tav();
 					GB_ASSERT(tav.mode != Addressing_Invalid);
 
 					Selection sel = lookup_field(type, interned, false);
@@ -2067,7 +2067,7 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 				isize multiple_return_offset = 0;
 				for_array(i, cl->elems) {
 					Entity *f = type->Struct.fields[i+multiple_return_offset];
-					TypeAndValue tav = cl->elems[i]->tav;
+					TypeAndValue tav = cl->elems[i]->tav();
 
 					if (is_type_tuple(tav.type)){
 						multiple_return_offset += tav.type->Tuple.variables.count-1;
@@ -2168,7 +2168,7 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 				Ast *e = cl->elems[i];
 				GB_ASSERT(e->kind != Ast_FieldValue);
 
-				TypeAndValue tav = e->tav;
+				TypeAndValue tav = e->tav();
 				if (tav.mode != Addressing_Constant) {
 					continue;
 				}
@@ -2201,8 +2201,8 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 					ast_node(fv, FieldValue, elem);
 					if (is_ast_range(fv->field)) {
 						ast_node(ie, BinaryExpr, fv->field);
-						TypeAndValue lo_tav = ie->left->tav;
-						TypeAndValue hi_tav = ie->right->tav;
+						TypeAndValue lo_tav = ie->left->tav();
+						TypeAndValue hi_tav = ie->right->tav();
 						GB_ASSERT(lo_tav.mode == Addressing_Constant);
 						GB_ASSERT(hi_tav.mode == Addressing_Constant);
 
@@ -2217,7 +2217,7 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 						GB_ASSERT(lo <= hi);
 						
 						
-						TypeAndValue tav = fv->value->tav;
+						TypeAndValue tav = fv->value->tav();
 						LLVMValueRef val = lb_const_value(m, elem_type, tav.value, tav.type, cc).value;
 						for (i64 k = lo; k < hi; k++) {
 							i64 offset = matrix_row_major_index_to_offset(type, k);
@@ -2225,11 +2225,11 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 							values[offset] = val;
 						}
 					} else {
-						TypeAndValue index_tav = fv->field->tav;
+						TypeAndValue index_tav = fv->field->tav();
 						GB_ASSERT(index_tav.mode == Addressing_Constant);
 						i64 index = exact_value_to_i64(index_tav.value);
 						GB_ASSERT(index < max_count);
-						TypeAndValue tav = fv->value->tav;
+						TypeAndValue tav = fv->value->tav();
 						LLVMValueRef val = lb_const_value(m, elem_type, tav.value, tav.type, cc).value;
 						i64 offset = matrix_row_major_index_to_offset(type, index);
 						GB_ASSERT(values[offset] == nullptr);
@@ -2250,7 +2250,7 @@ gb_internal lbValue lb_const_value(lbModule *m, Type *type, ExactValue value, Ty
 
 				LLVMValueRef *values = gb_alloc_array(temporary_allocator(), LLVMValueRef, cast(isize)total_count);
 				for_array(i, cl->elems) {
-					TypeAndValue tav = cl->elems[i]->tav;
+					TypeAndValue tav = cl->elems[i]->tav();
 					GB_ASSERT(tav.mode != Addressing_Invalid);
 					i64 offset = 0;
 					offset = matrix_row_major_index_to_offset(type, i);
@@ -2013,9 +2013,9 @@ handle_op:;
 }
 
 gb_internal bool lb_is_empty_string_constant(Ast *expr) {
-	if (expr->tav.value.kind == ExactValue_String &&
-	    is_type_string(expr->tav.type)) {
-		String s = expr->tav.value.value_string;
+	if (expr->tav().value.kind == ExactValue_String &&
+	    is_type_string(expr->tav().type)) {
+		String s = expr->tav().value.value_string;
 		return s.len == 0;
 	}
 	return false;
@@ -2078,7 +2078,7 @@ gb_internal lbValue lb_build_binary_expr(lbProcedure *p, Ast *expr) {
 
 	TypeAndValue tv = type_and_value_of_expr(expr);
 
-	if (is_type_matrix(be->left->tav.type) || is_type_matrix(be->right->tav.type)) {
+	if (is_type_matrix(be->left->tav().type) || is_type_matrix(be->right->tav().type)) {
 		lbValue left = lb_build_expr(p, be->left);
 		lbValue right = lb_build_expr(p, be->right);
 		return lb_emit_arith_matrix(p, be->op.kind, left, right, default_type(tv.type), false);
@@ -2120,22 +2120,22 @@ gb_internal lbValue lb_build_binary_expr(lbProcedure *p, Ast *expr) {
 
 	case Token_CmpEq:
 	case Token_NotEq:
-		if (is_type_untyped_nil(be->right->tav.type)) {
+		if (is_type_untyped_nil(be->right->tav().type)) {
 			// `x == nil` or `x != nil`
 			lbValue left = lb_build_expr(p, be->left);
 			lbValue cmp = lb_emit_comp_against_nil(p, be->op.kind, left);
 			Type *type = default_type(tv.type);
 			return lb_emit_conv(p, cmp, type);
-		} else if (is_type_untyped_nil(be->left->tav.type)) {
+		} else if (is_type_untyped_nil(be->left->tav().type)) {
 			// `nil == x` or `nil != x`
 			lbValue right = lb_build_expr(p, be->right);
 			lbValue cmp = lb_emit_comp_against_nil(p, be->op.kind, right);
 			Type *type = default_type(tv.type);
 			return lb_emit_conv(p, cmp, type);
-		} else if (lb_is_empty_string_constant(be->right) && !is_type_union(be->left->tav.type)) {
+		} else if (lb_is_empty_string_constant(be->right) && !is_type_union(be->left->tav().type)) {
 			// `x == ""` or `x != ""`
 			Type *str_type = t_string;
-			if (is_type_string16(be->left->tav.type) || is_type_cstring16(be->left->tav.type)) {
+			if (is_type_string16(be->left->tav().type) || is_type_cstring16(be->left->tav().type)) {
 				str_type = t_string16;
 			}
 			lbValue s = lb_build_expr(p, be->left);
@@ -2144,10 +2144,10 @@ gb_internal lbValue lb_build_binary_expr(lbProcedure *p, Ast *expr) {
 			lbValue cmp = lb_emit_comp(p, be->op.kind, len, lb_const_int(p->module, t_int, 0));
 			Type *type = default_type(tv.type);
 			return lb_emit_conv(p, cmp, type);
-		} else if (lb_is_empty_string_constant(be->left) && !is_type_union(be->right->tav.type)) {
+		} else if (lb_is_empty_string_constant(be->left) && !is_type_union(be->right->tav().type)) {
 			// `"" == x` or `"" != x`
 			Type *str_type = t_string;
-			if (is_type_string16(be->right->tav.type) || is_type_cstring16(be->right->tav.type)) {
+			if (is_type_string16(be->right->tav().type) || is_type_cstring16(be->right->tav().type)) {
 				str_type = t_string16;
 			}
 			lbValue s = lb_build_expr(p, be->right);
@@ -2166,11 +2166,11 @@ gb_internal lbValue lb_build_binary_expr(lbProcedure *p, Ast *expr) {
 			lbValue left = {};
 			lbValue right = {};
 
-			if (be->left->tav.mode == Addressing_Type) {
-				left = lb_typeid(p->module, be->left->tav.type);
+			if (be->left->tav().mode == Addressing_Type) {
+				left = lb_typeid(p->module, be->left->tav().type);
 			}
-			if (be->right->tav.mode == Addressing_Type) {
-				right = lb_typeid(p->module, be->right->tav.type);
+			if (be->right->tav().mode == Addressing_Type) {
+				right = lb_typeid(p->module, be->right->tav().type);
 			}
 			if (left.value == nullptr)  left  = lb_build_expr(p, be->left);
 			if (right.value == nullptr) right = lb_build_expr(p, be->right);
@@ -3317,25 +3317,9 @@ gb_internal lbValue lb_compare_records(lbProcedure *p, TokenKind op_kind, lbValu
 	TEMPORARY_ALLOCATOR_GUARD();
 
 	if (is_type_simple_compare(type)) {
-		// if (size <= 8) {
-		// 	LLVMTypeRef int_type = LLVMIntTypeInContext(p->module->ctx, cast(unsigned)(size*8));
-		// 	LLVMValueRef l = OdinLLVMBuildLoad(p, int_type, LLVMBuildPointerCast(p->builder, left_ptr.value,  LLVMPointerType(int_type, 0), ""));
-		// 	LLVMValueRef r = OdinLLVMBuildLoad(p, int_type, LLVMBuildPointerCast(p->builder, right_ptr.value, LLVMPointerType(int_type, 0), ""));
-
-		// 	LLVMIntPredicate pred = (op_kind == Token_CmpEq) ? LLVMIntEQ : LLVMIntNE;
-		// 	LLVMValueRef cmp = LLVMBuildICmp(p->builder, pred, l, r, "");
-
-		// 	res.value = cmp;
-		// 	res.type = t_bool;
-		// 	return res;
-		// }
-
-		// TODO(bill): Test to see if this is actually faster!!!!
-		auto args = array_make<lbValue>(temporary_allocator(), 3);
-		args[0] = lb_emit_conv(p, left_ptr, t_rawptr);
-		args[1] = lb_emit_conv(p, right_ptr, t_rawptr);
-		args[2] = lb_const_int(p->module, t_int, type_size_of(type));
-		res = lb_emit_runtime_call(p, "memory_equal", args);
+		// NOTE: simple compare values are compared byte-wise: up to LB_INLINE_MEMORY_EQUAL_MAX_SIZE bytes
+		// inline with wide loads, and larger values through runtime.memory_equal
+		res = lb_emit_memory_equal_of_type(p, left_ptr, right_ptr, type);
 	} else {
 		lbValue value = lb_equal_proc_for_type(p->module, type);
 		auto args = array_make<lbValue>(temporary_allocator(), 2);
@@ -4395,7 +4379,7 @@ gb_internal Type *lb_build_expr_original_const_type(Ast *expr) {
 	Type *type = type_of_expr(expr);
 	if (is_type_union(type)) {
 		if (expr->kind == Ast_CallExpr) {
-			if (expr->CallExpr.proc->tav.mode == Addressing_Type) {
+			if (expr->CallExpr.proc->tav().mode == Addressing_Type) {
 				Type *res = lb_build_expr_original_const_type(expr->CallExpr.args[0]);
 				return res;
 			}
@@ -4935,8 +4919,8 @@ gb_internal void lb_build_addr_compound_lit_populate(lbProcedure *p, Slice<Ast *
 			}
 			if (is_ast_range(fv->field)) {
 				ast_node(ie, BinaryExpr, fv->field);
-				TypeAndValue lo_tav = ie->left->tav;
-				TypeAndValue hi_tav = ie->right->tav;
+				TypeAndValue lo_tav = ie->left->tav();
+				TypeAndValue hi_tav = ie->right->tav();
 				GB_ASSERT(lo_tav.mode == Addressing_Constant);
 				GB_ASSERT(hi_tav.mode == Addressing_Constant);
 
@@ -4977,7 +4961,7 @@ gb_internal void lb_build_addr_compound_lit_populate(lbProcedure *p, Slice<Ast *
 					}
 				}
 			} else {
-				auto tav = fv->field->tav;
+				auto tav = fv->field->tav();
 				GB_ASSERT(tav.mode == Addressing_Constant);
 				i64 index = exact_value_to_i64(tav.value);
 
@@ -5069,7 +5053,7 @@ gb_internal lbAddr lb_build_addr_index_expr(lbProcedure *p, Ast *expr) {
 		return lb_addr_soa_variable(val, index, ie->index);
 	}
 
-	if (ie->expr->tav.mode == Addressing_SoaVariable) {
+	if (ie->expr->tav().mode == Addressing_SoaVariable) {
 		// SOA Structures for slices/dynamic arrays
 		GB_ASSERT_MSG(is_type_multi_pointer(type_of_expr(ie->expr)), "%s", type_to_string(type_of_expr(ie->expr)));
 
@@ -5140,7 +5124,7 @@ gb_internal lbAddr lb_build_addr_index_expr(lbProcedure *p, Ast *expr) {
 		auto index_tv = type_and_value_of_expr(ie->index);
 		if (index_tv.mode != Addressing_Constant) {
 			lbValue len = lb_const_int(p->module, t_int, t->Array.count);
-			lb_emit_bounds_check(p, ast_token(ie->index), index, len);
+			lb_emit_index_bounds_check(p, ie, t, deref, index, len);
 		}
 		return lb_addr(elem);
 	}
@@ -5160,7 +5144,7 @@ gb_internal lbAddr lb_build_addr_index_expr(lbProcedure *p, Ast *expr) {
 		auto index_tv = type_and_value_of_expr(ie->index);
 		lbValue len = lb_emit_struct_ep(p, array, 1);
 		len = lb_emit_load(p, len);
-		lb_emit_bounds_check(p, ast_token(ie->index), index, len);
+		lb_emit_index_bounds_check(p, ie, t, deref, index, len);
 		return lb_addr(elem);
 	}
 
@@ -5195,7 +5179,7 @@ gb_internal lbAddr lb_build_addr_index_expr(lbProcedure *p, Ast *expr) {
 
 		if (index_tv.mode != Addressing_Constant) {
 			lbValue len = lb_const_int(p->module, t_int, t->EnumeratedArray.count);
-			lb_emit_bounds_check(p, ast_token(ie->index), index, len);
+			lb_emit_index_bounds_check(p, ie, t, deref, index, len);
 		}
 		return lb_addr(elem);
 	}
@@ -5209,7 +5193,7 @@ gb_internal lbAddr lb_build_addr_index_expr(lbProcedure *p, Ast *expr) {
 		lbValue elem = lb_slice_elem(p, slice);
 		lbValue index = lb_emit_conv(p, lb_build_expr(p, ie->index), t_int);
 		lbValue len = lb_slice_len(p, slice);
-		lb_emit_bounds_check(p, ast_token(ie->index), index, len);
+		lb_emit_index_bounds_check(p, ie, t, deref, index, len);
 		lbValue v = lb_emit_ptr_offset(p, elem, index);
 		return lb_addr(v);
 	}
@@ -5239,7 +5223,7 @@ gb_internal lbAddr lb_build_addr_index_expr(lbProcedure *p, Ast *expr) {
 		lbValue elem = lb_dynamic_array_elem(p, dynamic_array);
 		lbValue len = lb_dynamic_array_len(p, dynamic_array);
 		lbValue index = lb_emit_conv(p, lb_build_expr(p, ie->index), t_int);
-		lb_emit_bounds_check(p, ast_token(ie->index), index, len);
+		lb_emit_index_bounds_check(p, ie, t, deref, index, len);
 		lbValue v = lb_emit_ptr_offset(p, elem, index);
 		return lb_addr(v);
 	}
@@ -5267,7 +5251,7 @@ gb_internal lbAddr lb_build_addr_index_expr(lbProcedure *p, Ast *expr) {
 		auto index_tv = type_and_value_of_expr(ie->index);
 		if (index_tv.mode != Addressing_Constant) {
 			lbValue len = lb_const_int(p->module, t_int, bounds_len);
-			lb_emit_bounds_check(p, ast_token(ie->index), index, len);
+			lb_emit_index_bounds_check(p, ie, t, deref, index, len);
 		}
 		return lb_addr(elem);
 	}
@@ -5288,7 +5272,7 @@ gb_internal lbAddr lb_build_addr_index_expr(lbProcedure *p, Ast *expr) {
 		len = lb_string_len(p, str);
 
 		index = lb_emit_conv(p, lb_build_expr(p, ie->index), t_int);
-		lb_emit_bounds_check(p, ast_token(ie->index), index, len);
+		lb_emit_index_bounds_check(p, ie, t, deref, index, len);
 
 		return lb_addr(lb_emit_ptr_offset(p, elem, index));
 	}
@@ -5856,7 +5840,7 @@ gb_internal void lb_build_addr_struct_compound_lit_populate(lbProcedure *p, Ast
 	isize field_index = 0;
 
 	for (Ast *elem : cl->elems) {
-		if (is_type_tuple(elem->tav.type)) {
+		if (is_type_tuple(elem->tav().type)) {
 			lbValue tuple_field_expr = lb_build_expr(p, elem);
 			GB_ASSERT(is_type_tuple(tuple_field_expr.type));
 
@@ -6483,7 +6467,7 @@ gb_internal lbAddr lb_build_addr_internal(lbProcedure *p, Ast *expr) {
 					a = lb_addr_get_ptr(p, addr);
 				}
 
-				Type *type = type_deref(expr->tav.type);
+				Type *type = type_deref(expr->tav().type);
 				GB_ASSERT(is_type_array(type) || is_type_simd_vector(type));
 				return lb_addr_swizzle(a, type, swizzle_count, swizzle_indices);
 			}
@@ -6697,7 +6681,7 @@ gb_internal lbAddr lb_build_addr_internal(lbProcedure *p, Ast *expr) {
 
 	case_ast_node(ce, CallExpr, expr);
 		BuiltinProcId builtin_id = BuiltinProc_Invalid;
-		if (ce->proc->tav.mode == Addressing_Builtin) {
+		if (ce->proc->tav().mode == Addressing_Builtin) {
 			Entity *e = entity_of_node(ce->proc);
 			if (e != nullptr) {
 				builtin_id = cast(BuiltinProcId)e->Builtin.id;
@@ -6705,7 +6689,7 @@ gb_internal lbAddr lb_build_addr_internal(lbProcedure *p, Ast *expr) {
 				builtin_id = BuiltinProc_DIRECTIVE;
 			}
 		}
-		auto const &tv = expr->tav;
+		auto const &tv = expr->tav();
 		if (builtin_id == BuiltinProc_swizzle &&
 		    is_type_array(tv.type)) {
 		    	// NOTE(bill, 2021-08-09): `swizzle` has some bizarre semantics so it needs to be
@@ -6822,7 +6806,7 @@ gb_internal lbAddr lb_build_addr_internal(lbProcedure *p, Ast *expr) {
 		}
 
 		GB_ASSERT(block != nullptr);
-		TypeAndValue tv = expr->tav;
+		TypeAndValue tv = expr->tav();
 
 		lbValue lhs = {};
 		lbValue rhs = {};
@@ -59,6 +59,9 @@ gb_internal WORKER_TASK_PROC(lb_init_module_worker_proc) {
 	m->module_name = module_name;
 	m->ctx = LLVMContextCreate();
 	m->mod = LLVMModuleCreateWithNameInContext(m->module_name, m->ctx);
+	if (build_context.optimization_remarks_filter.len != 0) {
+		LLVMContextSetDiagnosticHandler(m->ctx, lb_optimization_remark_handler, nullptr);
+	}
 	// m->debug_builder = nullptr;
 	if (build_context.no_plt) {
 		LLVMAddModuleFlag(m->mod,
@@ -793,6 +796,252 @@ gb_internal void lb_emit_bounds_check(lbProcedure *p, Token token, lbValue index
 	lb_emit_runtime_call(p, "bounds_check_error", args);
 }
 
+struct lbBoundsCheckReportEntry {
+	TokenPos    pos;
+	char const *elided_reason; // nullptr if the check was kept
+	bool        hoisted;       // kept, but only evaluated when the hoisted length comparison failed
+};
+
+gb_global BlockingMutex                    lb_bounds_check_report_mutex;
+gb_global Array<lbBoundsCheckReportEntry>  lb_bounds_check_report;
+
+// NOTE: An array variable whose length can only change through direct assignment or through a pointer to it.
+// Locals and parameters which are never reassigned nor have their address taken keep the same length for
+// their whole lifetime; globals can be changed by any call.
+gb_internal Entity *lb_bounds_fact_entity(Ast *expr) {
+	expr = unparen_expr(expr);
+	if (expr == nullptr || expr->kind != Ast_Ident) {
+		return nullptr;
+	}
+	Entity *e = entity_of_node(expr);
+	if (e == nullptr || e->kind != Entity_Variable || e->scope == nullptr) {
+		return nullptr;
+	}
+	u64 unsafe_flags = EntityFlag_Reassigned|EntityFlag_Static|EntityFlag_Using|EntityFlag_Field|EntityFlag_ImplicitReference;
+	if ((e->flags & unsafe_flags) != 0) {
+		return nullptr;
+	}
+	if ((e->scope->flags & (ScopeFlag_Pkg|ScopeFlag_Global|ScopeFlag_File)) != 0) {
+		return nullptr;
+	}
+	if (is_type_pointer(e->type)) {
+		return nullptr;
+	}
+	return e;
+}
+
+gb_internal void lb_push_bounds_fact(lbProcedure *p, Ast *index, Entity *array, i64 const_len, Scope *scope, lbBlock *preheader) {
+	if (index == nullptr || is_blank_ident(index) || (array == nullptr && const_len < 0)) {
+		return;
+	}
+	Entity *e = entity_of_node(index);
+	if (e == nullptr || (e->flags & EntityFlag_Value) == 0) {
+		return;
+	}
+	array_add(&p->bounds_facts, lbBoundsFact{e, array, const_len, scope, preheader});
+}
+
+gb_internal char const *lb_index_bounds_check_elided_reason(lbProcedure *p, AstIndexExpr *ie, Type *indexed_type, bool deref) {
+	Ast *index = unparen_expr(ie->index);
+	if (index->kind != Ast_Ident || p->bounds_facts.count == 0) {
+		return nullptr;
+	}
+	Entity *index_entity = entity_of_node(index);
+	if (index_entity == nullptr) {
+		return nullptr;
+	}
+
+	i64 const_len = -1;
+	if (indexed_type->kind == Type_Array) {
+		const_len = indexed_type->Array.count;
+	}
+	Entity *array_entity = deref ? nullptr : lb_bounds_fact_entity(ie->expr);
+
+	for (isize i = p->bounds_facts.count-1; i >= 0; i--) {
+		lbBoundsFact const &fact = p->bounds_facts[i];
+		if (fact.index != index_entity) {
+			continue;
+		}
+		if (fact.const_len >= 0 && const_len >= 0 && fact.const_len <= const_len) {
+			return "loop index below the constant length";
+		}
+		if (fact.array != nullptr && fact.array == array_entity) {
+			return "loop index over the indexed value";
+		}
+	}
+	return nullptr;
+}
+
+gb_internal bool lb_is_type_bounds_fact_len(Type *t) {
+	t = base_type(t);
+	switch (t->kind) {
+	case Type_Array:
+	case Type_Slice:
+	case Type_DynamicArray:
+		return true;
+	case Type_Basic:
+		return is_type_string(t) && !is_type_cstring(t) && !is_type_cstring16(t);
+	}
+	return false;
+}
+
+gb_internal lbValue lb_bounds_fact_len(lbProcedure *p, Entity *e) {
+	lbValue value = lb_find_ident(p, p->module, e, nullptr);
+	Type *t = base_type(value.type);
+	switch (t->kind) {
+	case Type_Array:        return lb_const_int(p->module, t_int, t->Array.count);
+	case Type_Slice:        return lb_slice_len(p, value);
+	case Type_DynamicArray: return lb_dynamic_array_len(p, value);
+	}
+	return lb_emit_conv(p, lb_string_len(p, value), t_int);
+}
+
+gb_internal bool lb_bounds_fact_has_value(lbProcedure *p, Entity *e) {
+	if (map_get(&p->direct_parameters, e) != nullptr) {
+		return true;
+	}
+	rw_mutex_shared_lock(&p->module->values_mutex);
+	bool found = map_get(&p->module->values, e) != nullptr;
+	rw_mutex_shared_unlock(&p->module->values_mutex);
+	return found;
+}
+
+// NOTE: `for v, i in x { y[i] }` compares `len(y) >= len(x)` once before the loop, and the per-iteration check
+// of `y[i]` is only reached when that comparison failed. The check itself cannot move out of the loop as the
+// panic must still happen on the offending iteration, but the condition guarding it is now loop invariant, so
+// LLVM can unswitch the loop into a checked and an unchecked (vectorizable) version.
+gb_internal lbValue lb_hoist_index_bounds_check(lbProcedure *p, AstIndexExpr *ie, Type *indexed_type, bool deref) {
+	Ast *index = unparen_expr(ie->index);
+	if (deref || index->kind != Ast_Ident || p->bounds_facts.count == 0 || !lb_is_type_bounds_fact_len(indexed_type)) {
+		return {};
+	}
+
+	Entity *index_entity = entity_of_node(index);
+	Entity *array_entity = lb_bounds_fact_entity(ie->expr);
+	if (index_entity == nullptr || array_entity == nullptr) {
+		return {};
+	}
+	if (!lb_bounds_fact_has_value(p, array_entity)) {
+		return {};
+	}
+
+	for (isize i = p->bounds_facts.count-1; i >= 0; i--) {
+		lbBoundsFact const &fact = p->bounds_facts[i];
+		if (fact.index != index_entity) {
+			continue;
+		}
+		if (fact.preheader == nullptr || fact.scope == nullptr) {
+			return {};
+		}
+		if (fact.const_len < 0 && (!lb_is_type_bounds_fact_len(fact.array->type) || !lb_bounds_fact_has_value(p, fact.array))) {
+			return {};
+		}
+		// The array must already exist before the loop
+		for (Scope *s = array_entity->scope; s != nullptr; s = s->parent) {
+			if (s == fact.scope) {
+				return {};
+			}
+		}
+
+		for (lbBoundsGuard const &guard : p->bounds_guards) {
+			if (guard.index == index_entity && guard.array == array_entity) {
+				return guard.in_range;
+			}
+		}
+
+		LLVMValueRef terminator = LLVMGetBasicBlockTerminator(fact.preheader->block);
+		if (terminator == nullptr) {
+			return {};
+		}
+
+		lbBlock *curr_block = p->curr_block;
+		LLVMPositionBuilderBefore(p->builder, terminator);
+		p->curr_block = fact.preheader;
+
+		lbValue bound = {};
+		if (fact.const_len >= 0) {
+			bound = lb_const_int(p->module, t_int, fact.const_len);
+		} else {
+			bound = lb_bounds_fact_len(p, fact.array);
+		}
+		lbValue len = lb_bounds_fact_len(p, array_entity);
+		lbValue in_range = lb_emit_comp(p, Token_LtEq, bound, len);
+
+		p->curr_block = curr_block;
+		LLVMPositionBuilderAtEnd(p->builder, curr_block->block);
+
+		array_add(&p->bounds_guards, lbBoundsGuard{index_entity, array_entity, in_range});
+		return in_range;
+	}
+	return {};
+}
+
+gb_internal void lb_emit_index_bounds_check(lbProcedure *p, AstIndexExpr *ie, Type *indexed_type, bool deref, lbValue index, lbValue len) {
+	if (lb_bounds_check_disabled(p)) {
+		return;
+	}
+
+	char const *elided_reason = lb_index_bounds_check_elided_reason(p, ie, indexed_type, deref);
+	if (elided_reason == nullptr && lb_bounds_check_short_circuit(p, index, len)) {
+		elided_reason = "index known to be in range";
+	}
+	lbValue in_range = {};
+	if (elided_reason == nullptr) {
+		in_range = lb_hoist_index_bounds_check(p, ie, indexed_type, deref);
+	}
+
+	if (build_context.show_bounds_checks) {
+		mutex_lock(&lb_bounds_check_report_mutex);
+		if (lb_bounds_check_report.allocator.proc == nullptr) {
+			array_init(&lb_bounds_check_report, heap_allocator());
+		}
+		array_add(&lb_bounds_check_report, lbBoundsCheckReportEntry{ast_token(ie->index).pos, elided_reason, in_range.value != nullptr});
+		mutex_unlock(&lb_bounds_check_report_mutex);
+	}
+
+	if (elided_reason != nullptr) {
+		return;
+	}
+	if (in_range.value == nullptr) {
+		lb_emit_bounds_check(p, ast_token(ie->index), index, len);
+		return;
+	}
+
+	lbBlock *check = lb_create_block(p, "bounds.check");
+	lbBlock *done  = lb_create_block(p, "bounds.check.done");
+	lb_emit_if(p, in_range, done, check);
+	lb_start_block(p, check);
+	lb_emit_bounds_check(p, ast_token(ie->index), index, len);
+	lb_emit_jump(p, done);
+	lb_start_block(p, done);
+}
+
+gb_internal GB_COMPARE_PROC(lb_bounds_check_report_cmp) {
+	lbBoundsCheckReportEntry const *x = cast(lbBoundsCheckReportEntry const *)a;
+	lbBoundsCheckReportEntry const *y = cast(lbBoundsCheckReportEntry const *)b;
+	return token_pos_cmp(x->pos, y->pos);
+}
+
+gb_internal void lb_print_bounds_check_report(void) {
+	array_sort(lb_bounds_check_report, lb_bounds_check_report_cmp);
+
+	isize elided = 0;
+	isize hoisted = 0;
+	for (lbBoundsCheckReportEntry const &entry : lb_bounds_check_report) {
+		String path = get_file_path_string(entry.pos.file_id);
+		if (entry.elided_reason != nullptr) {
+			elided += 1;
+			gb_printf("%.*s(%d:%d) bounds check elided: %s\n", LIT(path), entry.pos.line, entry.pos.column, entry.elided_reason);
+		} else if (entry.hoisted) {
+			hoisted += 1;
+			gb_printf("%.*s(%d:%d) bounds check hoisted: length compared once before the loop\n", LIT(path), entry.pos.line, entry.pos.column);
+		} else {
+			gb_printf("%.*s(%d:%d) bounds check kept\n", LIT(path), entry.pos.line, entry.pos.column);
+		}
+	}
+	gb_printf("%td bounds checks, %td elided, %td hoisted\n", lb_bounds_check_report.count, elided, hoisted);
+}
+
 gb_internal void lb_emit_matrix_bounds_check(lbProcedure *p, Token token, lbValue row_index, lbValue column_index, lbValue row_count, lbValue column_count) {
 	if (lb_bounds_check_disabled(p)) {
 		return;
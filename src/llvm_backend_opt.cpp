@@ -443,6 +443,123 @@ gb_internal void lb_run_remove_unused_function_pass(lbModule *m) {
 }
 
 
+gb_internal bool lb_context_param_is_unused(LLVMValueRef func) {
+	unsigned param_count = LLVMCountParams(func);
+	if (param_count == 0) {
+		return false;
+	}
+	// NOTE: the implicit context pointer is always the last parameter of an Odin calling convention procedure
+	LLVMValueRef context_ptr = LLVMGetParam(func, param_count-1);
+	return LLVMGetFirstUse(context_ptr) == nullptr;
+}
+
+// NOTE: A weak or link-once definition may be replaced at link time by another body which does read
+// `context`, so only procedures whose definition cannot be interposed are treated as context-free
+gb_internal bool lb_procedure_body_is_final(lbProcedure *p) {
+	if (p->entity != nullptr &&
+	    (p->entity->flags & (EntityFlag_CustomLinkage_Weak|EntityFlag_CustomLinkage_LinkOnce)) != 0) {
+		return false;
+	}
+	switch (LLVMGetLinkage(p->value)) {
+	case LLVMExternalLinkage:
+	case LLVMInternalLinkage:
+	case LLVMPrivateLinkage:
+		return true;
+	default:
+		return false;
+	}
+}
+
+// NOTE: Every direct call to an Odin calling convention procedure passes the implicit context pointer,
+// even when the callee never reads `context`. This pass finds the procedures whose context parameter has
+// no uses in the generated IR and passes poison at their direct call sites instead, across all modules.
+// A caller whose only uses of its own context were such arguments becomes context-free too, so the
+// elision propagates transitively up the call graph through a worklist.
+//
+// The parameter itself is kept so that the ABI is unchanged for exported and address-taken procedures,
+// and indirect calls still pass the real context. The callers no longer need to keep the context pointer
+// live across those calls, and internal procedures can still have the parameter removed entirely by
+// dead argument elimination in the module passes.
+gb_internal void lb_run_elide_unused_context_pass(lbGenerator *gen) {
+	PtrMap<LLVMValueRef, lbProcedure *> definitions = {};
+	map_init(&definitions);
+	defer (map_destroy(&definitions));
+
+	PtrSet<LLVMValueRef> context_free = {};
+	ptr_set_init(&context_free);
+	defer (ptr_set_destroy(&context_free));
+
+	auto worklist = array_make<lbProcedure *>(heap_allocator());
+	defer (array_free(&worklist));
+
+	for (auto const &entry : gen->modules) {
+		lbModule *m = entry.value;
+		for (lbProcedure *p : m->generated_procedures) {
+			if (p->value == nullptr || LLVMIsDeclaration(p->value)) {
+				continue;
+			}
+			Type *pt = base_type(p->type);
+			if (pt == nullptr || pt->kind != Type_Proc || pt->Proc.calling_convention != ProcCC_Odin) {
+				continue;
+			}
+			map_set(&definitions, p->value, p);
+			if (lb_procedure_body_is_final(p) && lb_context_param_is_unused(p->value)) {
+				ptr_set_add(&context_free, p->value);
+				array_add(&worklist, p);
+			}
+		}
+	}
+
+	while (worklist.count != 0) {
+		lbProcedure *callee = array_pop(&worklist);
+
+		size_t name_len = 0;
+		char const *name = LLVMGetValueName2(callee->value, &name_len);
+		if (name_len == 0) {
+			continue;
+		}
+
+		for (auto const &entry : gen->modules) {
+			lbModule *m = entry.value;
+			LLVMValueRef func = callee->value;
+			if (m != callee->module) {
+				// NOTE: other modules refer to the procedure through their own declaration of it
+				func = LLVMGetNamedFunction(m->mod, name);
+				if (func == nullptr || !LLVMIsDeclaration(func)) {
+					continue;
+				}
+			}
+
+			for (LLVMUseRef use = LLVMGetFirstUse(func); use != nullptr; use = LLVMGetNextUse(use)) {
+				LLVMValueRef call = LLVMGetUser(use);
+				if (!LLVMIsACallInst(call) || LLVMGetCalledValue(call) != func) {
+					// NOTE: address-taken uses are left alone, indirect calls still pass the context
+					continue;
+				}
+				unsigned arg_count = LLVMGetNumArgOperands(call);
+				if (arg_count == 0) {
+					continue;
+				}
+				LLVMValueRef context_arg = LLVMGetOperand(call, arg_count-1);
+				if (LLVMIsPoison(context_arg)) {
+					continue;
+				}
+				LLVMSetOperand(call, arg_count-1, LLVMGetPoison(LLVMTypeOf(context_arg)));
+
+				LLVMValueRef caller = LLVMGetBasicBlockParent(LLVMGetInstructionParent(call));
+				lbProcedure **found = map_get(&definitions, caller);
+				if (found == nullptr || ptr_set_exists(&context_free, caller)) {
+					continue;
+				}
+				if (lb_procedure_body_is_final(*found) && lb_context_param_is_unused(caller)) {
+					ptr_set_add(&context_free, caller);
+					array_add(&worklist, *found);
+				}
+			}
+		}
+	}
+}
+
 gb_internal void lb_run_remove_unused_globals_pass(lbModule *m) {
 	isize removal_count = 0;
 	isize pass_count = 0;
@@ -489,3 +606,169 @@ gb_internal void lb_run_remove_unused_globals_pass(lbModule *m) {
 }
 
 
+
+
+/**************************************************************************
+	Optimization Remarks (-show-optimization-remarks:<filter>)
+
+	LLVM's passes report what they did and did not do as remarks, which are
+	only emitted for the passes matching `-pass-remarks*`. They are collected
+	here from every module's context and printed once code generation is done.
+**************************************************************************/
+
+struct lbOptimizationRemark {
+	String file;    // as named by the debug info, empty if the location is unknown
+	i32    line;
+	i32    column;
+	String message;
+};
+
+gb_global BlockingMutex               lb_optimization_remarks_mutex;
+gb_global Array<lbOptimizationRemark> lb_optimization_remarks;
+
+// NOTE: Remarks are described as "file:line:column: message", with "<unknown>:0:0" without debug info
+gb_internal lbOptimizationRemark lb_parse_optimization_remark(String desc) {
+	lbOptimizationRemark remark = {};
+	remark.message = desc;
+
+	for (isize i = 0; i+1 < desc.len; i++) {
+		if (desc[i] != ':' || desc[i+1] != ' ') {
+			continue;
+		}
+		i32 values[2] = {};
+		isize j = i;
+		bool ok = true;
+		for (isize k = 1; k >= 0 && ok; k--) {
+			isize end = j;
+			i32 value = 0, scale = 1;
+			while (j > 0 && gb_char_is_digit(desc[j-1])) {
+				j -= 1;
+				value += cast(i32)(desc[j]-'0') * scale;
+				scale *= 10;
+			}
+			ok = j < end && j > 0 && desc[j-1] == ':';
+			values[k] = value;
+			j -= 1;
+		}
+		if (!ok) {
+			continue;
+		}
+
+		String file = substring(desc, 0, j);
+		if (file != "<unknown>") {
+			remark.file   = file;
+			remark.line   = values[0];
+			remark.column = values[1];
+		}
+		remark.message = substring(desc, i+2, desc.len);
+		break;
+	}
+	return remark;
+}
+
+gb_internal void lb_optimization_remark_handler(LLVMDiagnosticInfoRef info, void *user_data) {
+	char *desc = LLVMGetDiagInfoDescription(info);
+	LLVMDiagnosticSeverity severity = LLVMGetDiagInfoSeverity(info);
+	if (severity != LLVMDSRemark) {
+		// NOTE: Installing a handler replaces LLVM's own reporting, so report everything else as it would
+		char const *prefix = "note";
+		switch (severity) {
+		case LLVMDSError:   prefix = "error";   break;
+		case LLVMDSWarning: prefix = "warning"; break;
+		}
+		gb_printf_err("%s: %s\n", prefix, desc);
+		LLVMDisposeMessage(desc);
+		if (severity == LLVMDSError) {
+			gb_exit(1);
+		}
+		return;
+	}
+
+	String copy = copy_string(heap_allocator(), make_string_c(desc));
+	LLVMDisposeMessage(desc);
+
+	mutex_lock(&lb_optimization_remarks_mutex);
+	if (lb_optimization_remarks.allocator.proc == nullptr) {
+		array_init(&lb_optimization_remarks, heap_allocator());
+	}
+	array_add(&lb_optimization_remarks, lb_parse_optimization_remark(copy));
+	mutex_unlock(&lb_optimization_remarks_mutex);
+}
+
+// NOTE: For the front-end's own optimizations, reported alongside LLVM's remarks
+gb_internal void lb_add_optimization_remark(TokenPos pos, char const *fmt, ...) {
+	lbOptimizationRemark remark = {};
+	if (AstFile *f = thread_safe_get_ast_file_from_id(pos.file_id)) {
+		remark.file   = f->filename;
+		remark.line   = pos.line;
+		remark.column = pos.column;
+	}
+
+	char buf[1024] = {};
+	va_list va;
+	va_start(va, fmt);
+	isize len = gb_snprintf_va(buf, gb_count_of(buf)-1, fmt, va)-1;
+	va_end(va);
+	remark.message = copy_string(heap_allocator(), make_string(cast(u8 *)buf, len));
+
+	mutex_lock(&lb_optimization_remarks_mutex);
+	if (lb_optimization_remarks.allocator.proc == nullptr) {
+		array_init(&lb_optimization_remarks, heap_allocator());
+	}
+	array_add(&lb_optimization_remarks, remark);
+	mutex_unlock(&lb_optimization_remarks_mutex);
+}
+
+gb_internal GB_COMPARE_PROC(lb_optimization_remark_cmp) {
+	lbOptimizationRemark const *x = cast(lbOptimizationRemark const *)a;
+	lbOptimizationRemark const *y = cast(lbOptimizationRemark const *)b;
+	if ((x->file.len == 0) != (y->file.len == 0)) {
+		return x->file.len == 0 ? +1 : -1;
+	}
+	if (int cmp = string_compare(x->file, y->file)) {
+		return cmp;
+	}
+	if (x->line != y->line) {
+		return x->line < y->line ? -1 : +1;
+	}
+	if (x->column != y->column) {
+		return x->column < y->column ? -1 : +1;
+	}
+	return string_compare(x->message, y->message);
+}
+
+gb_internal void lb_print_optimization_remarks(lbGenerator *gen) {
+	// NOTE: The debug info only names the file, use the full path when it is unambiguous
+	StringMap<String> full_paths = {};
+	string_map_init(&full_paths, gen->info->files.count);
+	defer (string_map_destroy(&full_paths));
+	for (auto const &entry : gen->info->files) {
+		AstFile *f = entry.value;
+		if (String *found = string_map_get(&full_paths, f->filename)) {
+			*found = f->filename;
+		} else {
+			string_map_set(&full_paths, f->filename, f->fullpath);
+		}
+	}
+
+	array_sort(lb_optimization_remarks, lb_optimization_remark_cmp);
+
+	isize count = 0;
+	for_array(i, lb_optimization_remarks) {
+		lbOptimizationRemark const &remark = lb_optimization_remarks[i];
+		if (i > 0 && lb_optimization_remark_cmp(&lb_optimization_remarks[i-1], &remark) == 0) {
+			continue; // the same procedure may be optimized in more than one module
+		}
+		count += 1;
+		if (remark.file.len == 0) {
+			gb_printf("remark: %.*s\n", LIT(remark.message));
+			continue;
+		}
+		String path = remark.file;
+		if (String *found = string_map_get(&full_paths, path)) {
+			path = *found;
+		}
+		gb_printf("%.*s(%d:%d) remark: %.*s\n", LIT(path), remark.line, remark.column, LIT(remark.message));
+	}
+	gb_printf("%td optimization remarks\n", count);
+}
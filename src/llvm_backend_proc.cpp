@@ -133,6 +133,8 @@ gb_internal lbProcedure *lb_create_procedure(lbModule *m, Entity *entity, bool i
 	p->context_stack.allocator     = a;
 	p->scope_stack.allocator       = a;
 	p->asan_stack_locals.allocator = a;
+	p->bounds_facts.allocator      = a;
+	p->bounds_guards.allocator     = a;
 	// map_init(&p->selector_values,  0);
 	// map_init(&p->selector_addr,    0);
 	// map_init(&p->tuple_fix_map,    0);
@@ -442,6 +444,8 @@ gb_internal lbProcedure *lb_create_dummy_procedure(lbModule *m, String link_name
 	p->branch_blocks.allocator     = a;
 	p->context_stack.allocator     = a;
 	p->asan_stack_locals.allocator = a;
+	p->bounds_facts.allocator      = a;
+	p->bounds_guards.allocator     = a;
 	map_init(&p->tuple_fix_map, 0);
 
 
@@ -568,6 +572,373 @@ gb_internal void lb_set_debug_position_to_procedure_end(lbProcedure *p) {
 	}
 }
 
+// NOTE: `s := make([]T, N)` with a small constant `N` is backed by a stack array when `s` never escapes the
+// procedure: it is only indexed (without taking the address of an element), ranged over by value, passed to
+// `len`/`cap`, and finally freed with `delete(s)`, which then does nothing.
+#define LB_STACK_MAKE_MAX_SIZE       512
+#define LB_STACK_MAKE_MAX_TOTAL_SIZE 4096
+
+struct lbStackMakeCandidate {
+	Entity *e;
+	Ast *   call;
+	i64     size;
+};
+
+struct lbStackMakeAnalysis {
+	Array<lbStackMakeCandidate> candidates;
+	PtrSet<Entity *>            candidate_set;
+	PtrSet<Entity *>            escaped;
+	Array<Ast *>                deletes;
+	bool                        failed;
+};
+
+gb_internal bool lb_is_runtime_procedure(Entity *e, String const &name) {
+	return e != nullptr && e->kind == Entity_Procedure &&
+	       e->pkg != nullptr && e->pkg->kind == Package_Runtime &&
+	       e->token.string == name;
+}
+
+// Returns the size of the backing array of `make([]T, N)`, or -1 if it is not a candidate
+gb_internal i64 lb_stack_make_size(Ast *call) {
+	if (call->kind != Ast_CallExpr) {
+		return -1;
+	}
+	ast_node(ce, CallExpr, call);
+	if (!lb_is_runtime_procedure(entity_of_node(unparen_expr(ce->proc)), str_lit("make_slice")) ||
+	    ce->args.count != 2 || !ce->optional_ok_one ||
+	    ce->args[0]->kind == Ast_FieldValue || ce->args[1]->kind == Ast_FieldValue) {
+		return -1;
+	}
+	Type *slice_type = base_type(type_of_expr(ce->args[0]));
+	TypeAndValue len = type_and_value_of_expr(ce->args[1]);
+	if (slice_type == nullptr || slice_type->kind != Type_Slice ||
+	    len.mode != Addressing_Constant || len.value.kind != ExactValue_Integer) {
+		return -1;
+	}
+	i64 count = exact_value_to_i64(len.value);
+	i64 elem_size = type_size_of(slice_type->Slice.elem);
+	if (count <= 0 || elem_size <= 0 || count > LB_STACK_MAKE_MAX_SIZE/elem_size) {
+		return -1;
+	}
+	return count*elem_size;
+}
+
+gb_internal void lb_stack_make_escape_root(lbStackMakeAnalysis *a, Ast *expr) {
+	for (;;) {
+		expr = unparen_expr(expr);
+		switch (expr->kind) {
+		case Ast_SelectorExpr:    expr = expr->SelectorExpr.expr;    continue;
+		case Ast_IndexExpr:       expr = expr->IndexExpr.expr;       continue;
+		case Ast_MatrixIndexExpr: expr = expr->MatrixIndexExpr.expr; continue;
+		case Ast_SliceExpr:       expr = expr->SliceExpr.expr;       continue;
+		case Ast_Ident:
+			if (Entity *e = entity_of_node(expr)) {
+				ptr_set_add(&a->escaped, e);
+			}
+			return;
+		}
+		return;
+	}
+}
+
+gb_internal void lb_stack_make_visit(lbStackMakeAnalysis *a, Ast *node);
+
+gb_internal void lb_stack_make_visit_list(lbStackMakeAnalysis *a, Slice<Ast *> const &nodes) {
+	for (Ast *node : nodes) {
+		lb_stack_make_visit(a, node);
+	}
+}
+
+gb_internal void lb_stack_make_visit(lbStackMakeAnalysis *a, Ast *node) {
+	if (node == nullptr || a->failed) {
+		return;
+	}
+	switch (node->kind) {
+	case Ast_Ident: {
+		// Any use which is not one of the known safe forms below
+		Entity *e = entity_of_node(node);
+		if (e != nullptr && ptr_set_exists(&a->candidate_set, e)) {
+			ptr_set_add(&a->escaped, e);
+		}
+		break;
+	}
+
+	case Ast_Implicit:
+	case Ast_Uninit:
+	case Ast_BasicLit:
+	case Ast_BasicDirective:
+	case Ast_ProcGroup:
+	case Ast_ProcLit: // cannot refer to the locals of this procedure
+	case Ast_BadExpr:
+	case Ast_ImplicitSelectorExpr:
+	case Ast_EnumFieldValue:
+	case Ast_InlineAsmExpr:
+	case Ast_BadStmt:
+	case Ast_EmptyStmt:
+	case Ast_BranchStmt:
+	case Ast_BadDecl:
+	case Ast_ForeignBlockDecl:
+	case Ast_Label:
+	case Ast_PackageDecl:
+	case Ast_ImportDecl:
+	case Ast_ForeignImportDecl:
+	case Ast_Attribute:
+	case Ast_Field:
+	case Ast_BitFieldField:
+	case Ast_FieldList:
+		break;
+
+	case Ast_Ellipsis:      lb_stack_make_visit(a, node->Ellipsis.expr);   break;
+	case Ast_TagExpr:       lb_stack_make_visit(a, node->TagExpr.expr);    break;
+	case Ast_ParenExpr:     lb_stack_make_visit(a, node->ParenExpr.expr);  break;
+	case Ast_DerefExpr:     lb_stack_make_visit(a, node->DerefExpr.expr);  break;
+	case Ast_OrReturnExpr:  lb_stack_make_visit(a, node->OrReturnExpr.expr); break;
+	case Ast_OrBranchExpr:  lb_stack_make_visit(a, node->OrBranchExpr.expr); break;
+	case Ast_TypeAssertion: lb_stack_make_visit(a, node->TypeAssertion.expr); break;
+	case Ast_TypeCast:      lb_stack_make_visit(a, node->TypeCast.expr);   break;
+	case Ast_AutoCast:      lb_stack_make_visit(a, node->AutoCast.expr);   break;
+	case Ast_FieldValue:    lb_stack_make_visit(a, node->FieldValue.value); break;
+	case Ast_SelectorExpr:  lb_stack_make_visit(a, node->SelectorExpr.expr); break;
+	case Ast_ExprStmt:      lb_stack_make_visit(a, node->ExprStmt.expr);   break;
+	case Ast_DeferStmt:     lb_stack_make_visit(a, node->DeferStmt.stmt);  break;
+	case Ast_CompoundLit:   lb_stack_make_visit_list(a, node->CompoundLit.elems); break;
+	case Ast_ReturnStmt:    lb_stack_make_visit_list(a, node->ReturnStmt.results); break;
+	case Ast_BlockStmt:     lb_stack_make_visit_list(a, node->BlockStmt.stmts); break;
+	case Ast_UsingStmt:     lb_stack_make_visit_list(a, node->UsingStmt.list); break;
+
+	case Ast_UnaryExpr:
+		if (node->UnaryExpr.op.kind == Token_And) {
+			lb_stack_make_escape_root(a, node->UnaryExpr.expr);
+		}
+		lb_stack_make_visit(a, node->UnaryExpr.expr);
+		break;
+	case Ast_BinaryExpr:
+		lb_stack_make_visit(a, node->BinaryExpr.left);
+		lb_stack_make_visit(a, node->BinaryExpr.right);
+		break;
+	case Ast_TernaryIfExpr:
+		lb_stack_make_visit(a, node->TernaryIfExpr.x);
+		lb_stack_make_visit(a, node->TernaryIfExpr.cond);
+		lb_stack_make_visit(a, node->TernaryIfExpr.y);
+		break;
+	case Ast_TernaryWhenExpr:
+		lb_stack_make_visit(a, node->TernaryWhenExpr.x);
+		lb_stack_make_visit(a, node->TernaryWhenExpr.cond);
+		lb_stack_make_visit(a, node->TernaryWhenExpr.y);
+		break;
+	case Ast_OrElseExpr:
+		lb_stack_make_visit(a, node->OrElseExpr.x);
+		lb_stack_make_visit(a, node->OrElseExpr.y);
+		break;
+
+	case Ast_IndexExpr:
+		// `s[i]` only reads or writes an element
+		if (unparen_expr(node->IndexExpr.expr)->kind != Ast_Ident) {
+			lb_stack_make_visit(a, node->IndexExpr.expr);
+		}
+		lb_stack_make_visit(a, node->IndexExpr.index);
+		break;
+	case Ast_MatrixIndexExpr:
+		lb_stack_make_visit(a, node->MatrixIndexExpr.expr);
+		lb_stack_make_visit(a, node->MatrixIndexExpr.row_index);
+		lb_stack_make_visit(a, node->MatrixIndexExpr.column_index);
+		break;
+	case Ast_SliceExpr:
+		// Slicing an element which is an array takes its address
+		lb_stack_make_escape_root(a, node->SliceExpr.expr);
+		lb_stack_make_visit(a, node->SliceExpr.expr);
+		lb_stack_make_visit(a, node->SliceExpr.low);
+		lb_stack_make_visit(a, node->SliceExpr.high);
+		break;
+	case Ast_SelectorCallExpr:
+		// `x->f()` passes `&x`
+		if (node->SelectorCallExpr.expr->kind == Ast_SelectorExpr) {
+			lb_stack_make_escape_root(a, node->SelectorCallExpr.expr->SelectorExpr.expr);
+		}
+		lb_stack_make_visit(a, node->SelectorCallExpr.expr);
+		lb_stack_make_visit(a, node->SelectorCallExpr.call);
+		break;
+
+	case Ast_CallExpr: {
+		ast_node(ce, CallExpr, node);
+		Entity *proc_entity = entity_of_node(unparen_expr(ce->proc));
+		Ast *arg = ce->args.count == 1 ? unparen_expr(ce->args[0]) : nullptr;
+		if (arg != nullptr && arg->kind == Ast_Ident && proc_entity != nullptr) {
+			if (proc_entity->kind == Entity_Builtin) {
+				BuiltinProcId id = cast(BuiltinProcId)proc_entity->Builtin.id;
+				if (id == BuiltinProc_len || id == BuiltinProc_cap) {
+					break;
+				}
+			} else if (lb_is_runtime_procedure(proc_entity, str_lit("delete_slice"))) {
+				Entity *e = entity_of_node(arg);
+				if (e != nullptr && ptr_set_exists(&a->candidate_set, e)) {
+					array_add(&a->deletes, node);
+					break;
+				}
+			}
+		}
+		lb_stack_make_visit(a, ce->proc);
+		lb_stack_make_visit_list(a, ce->args);
+		break;
+	}
+
+	case Ast_AssignStmt:
+		lb_stack_make_visit_list(a, node->AssignStmt.lhs);
+		lb_stack_make_visit_list(a, node->AssignStmt.rhs);
+		break;
+	case Ast_IfStmt:
+		lb_stack_make_visit(a, node->IfStmt.init);
+		lb_stack_make_visit(a, node->IfStmt.cond);
+		lb_stack_make_visit(a, node->IfStmt.body);
+		lb_stack_make_visit(a, node->IfStmt.else_stmt);
+		break;
+	case Ast_WhenStmt:
+		lb_stack_make_visit(a, node->WhenStmt.cond);
+		lb_stack_make_visit(a, node->WhenStmt.body);
+		lb_stack_make_visit(a, node->WhenStmt.else_stmt);
+		break;
+	case Ast_ForStmt:
+		lb_stack_make_visit(a, node->ForStmt.init);
+		lb_stack_make_visit(a, node->ForStmt.cond);
+		lb_stack_make_visit(a, node->ForStmt.post);
+		lb_stack_make_visit(a, node->ForStmt.body);
+		break;
+	case Ast_RangeStmt: {
+		ast_node(rs, RangeStmt, node);
+		bool by_reference = false;
+		for (Ast *val : rs->vals) {
+			if (val != nullptr && val->kind == Ast_UnaryExpr && val->UnaryExpr.op.kind == Token_And) {
+				by_reference = true;
+			}
+		}
+		lb_stack_make_visit(a, rs->init);
+		if (by_reference) {
+			lb_stack_make_escape_root(a, rs->expr);
+		}
+		// `for v, i in s` copies each element out
+		if (by_reference || unparen_expr(rs->expr)->kind != Ast_Ident) {
+			lb_stack_make_visit(a, rs->expr);
+		}
+		lb_stack_make_visit(a, rs->body);
+		break;
+	}
+	case Ast_UnrollRangeStmt:
+		lb_stack_make_visit_list(a, node->UnrollRangeStmt.args);
+		lb_stack_make_visit(a, node->UnrollRangeStmt.init);
+		lb_stack_make_escape_root(a, node->UnrollRangeStmt.expr);
+		lb_stack_make_visit(a, node->UnrollRangeStmt.expr);
+		lb_stack_make_visit(a, node->UnrollRangeStmt.body);
+		break;
+	case Ast_CaseClause:
+		lb_stack_make_visit_list(a, node->CaseClause.list);
+		lb_stack_make_visit_list(a, node->CaseClause.stmts);
+		break;
+	case Ast_SwitchStmt:
+		lb_stack_make_visit(a, node->SwitchStmt.init);
+		lb_stack_make_visit(a, node->SwitchStmt.tag);
+		lb_stack_make_visit(a, node->SwitchStmt.body);
+		break;
+	case Ast_TypeSwitchStmt:
+		lb_stack_make_visit(a, node->TypeSwitchStmt.tag);
+		lb_stack_make_visit(a, node->TypeSwitchStmt.body);
+		break;
+
+	case Ast_ValueDecl: {
+		ast_node(vd, ValueDecl, node);
+		if (!vd->is_mutable) {
+			break;
+		}
+		if (vd->names.count == vd->values.count) {
+			for_array(i, vd->names) {
+				Entity *e = entity_of_node(vd->names[i]);
+				Ast *value = unparen_expr(vd->values[i]);
+				if (e == nullptr || e->kind != Entity_Variable || (e->flags & (EntityFlag_Static|EntityFlag_Reassigned)) != 0) {
+					continue;
+				}
+				i64 size = lb_stack_make_size(value);
+				if (size > 0) {
+					array_add(&a->candidates, lbStackMakeCandidate{e, value, size});
+					ptr_set_add(&a->candidate_set, e);
+				}
+			}
+		}
+		lb_stack_make_visit_list(a, vd->values);
+		break;
+	}
+
+	default:
+		if (is_ast_type(node)) {
+			break;
+		}
+		// NOTE: Unknown node, assume everything escapes
+		a->failed = true;
+		break;
+	}
+}
+
+gb_internal void lb_find_stack_makes(lbProcedure *p) {
+	if (build_context.optimization_level < 1 || p->body == nullptr) {
+		return;
+	}
+
+	lbStackMakeAnalysis a = {};
+	a.candidates.allocator = heap_allocator();
+	a.deletes.allocator    = heap_allocator();
+	defer (array_free(&a.candidates));
+	defer (array_free(&a.deletes));
+	defer (ptr_set_destroy(&a.candidate_set));
+	defer (ptr_set_destroy(&a.escaped));
+
+	lb_stack_make_visit(&a, p->body);
+	if (a.failed || a.candidates.count == 0) {
+		return;
+	}
+
+	i64 total_size = 0;
+	for (lbStackMakeCandidate const &c : a.candidates) {
+		TokenPos pos = ast_token(c.call).pos;
+		if (ptr_set_exists(&a.escaped, c.e)) {
+			if (build_context.show_stack_promotions) {
+				lb_add_optimization_remark(pos, "'%.*s' is heap allocated: it escapes the procedure", LIT(c.e->token.string));
+			}
+			continue;
+		}
+		if (total_size + c.size > LB_STACK_MAKE_MAX_TOTAL_SIZE) {
+			if (build_context.show_stack_promotions) {
+				lb_add_optimization_remark(pos, "'%.*s' is heap allocated: the procedure's stack budget is used up", LIT(c.e->token.string));
+			}
+			continue;
+		}
+		total_size += c.size;
+		ptr_set_add(&p->stack_make_calls, c.call);
+		if (build_context.show_stack_promotions) {
+			lb_add_optimization_remark(pos, "'%.*s' is stack allocated (%lld bytes)", LIT(c.e->token.string), cast(long long)c.size);
+		}
+	}
+
+	for (Ast *call : a.deletes) {
+		Entity *e = entity_of_node(unparen_expr(call->CallExpr.args[0]));
+		for (lbStackMakeCandidate const &c : a.candidates) {
+			if (c.e == e && ptr_set_exists(&p->stack_make_calls, c.call)) {
+				ptr_set_add(&p->stack_delete_calls, call);
+				break;
+			}
+		}
+	}
+}
+
+gb_internal lbValue lb_build_stack_make(lbProcedure *p, Ast *expr) {
+	ast_node(ce, CallExpr, expr);
+	Type *slice_type = type_of_expr(ce->args[0]);
+	Type *elem = base_type(slice_type)->Slice.elem;
+	i64 count = exact_value_to_i64(type_and_value_of_expr(ce->args[1]).value);
+
+	// NOTE: Zeroed where the call was, like `make`, as it may be executed more than once
+	lbAddr backing = lb_add_local_generated(p, alloc_type_array(elem, count), true);
+	lbValue data = lb_array_elem(p, backing.addr);
+	return lb_make_slice_value(p, slice_type, data, lb_const_int(p->module, t_int, count));
+}
+
 gb_internal void lb_begin_procedure_body(lbProcedure *p) {
 	DeclInfo *decl = decl_info_of_entity(p->entity);
 	if (decl != nullptr) {
@@ -587,6 +958,8 @@ gb_internal void lb_begin_procedure_body(lbProcedure *p) {
 	map_init(&p->direct_parameters);
 	p->variadic_reuses.allocator = heap_allocator();
 
+	lb_find_stack_makes(p);
+
 	GB_ASSERT(p->type != nullptr);
 
 	lb_ensure_abi_function_type(p->module, p);
@@ -1556,8 +1929,8 @@ gb_internal lbValue lb_build_builtin_simd_proc(lbProcedure *p, Ast *expr, TypeAn
 			lbValue arg0 = lb_build_expr(p, ce->args[0]);
 			LLVMTypeRef types[1] = {lb_type(m, arg0.type)};
 
-			GB_ASSERT(ce->args[1]->tav.value.kind == ExactValue_Integer);
-			int n = cast(int)exact_value_to_i64(ce->args[1]->tav.value);
+			GB_ASSERT(ce->args[1]->tav().value.kind == ExactValue_Integer);
+			int n = cast(int)exact_value_to_i64(ce->args[1]->tav().value);
 
 			if (n == 1) {
 				res.value = arg0.value;
@@ -2299,8 +2672,8 @@ gb_internal lbValue lb_build_builtin_simd_proc(lbProcedure *p, Ast *expr, TypeAn
 
 			u64 max_count = cast(u64)vt->SimdVector.count;
 
-			GB_ASSERT(ce->args[1]->tav.mode == Addressing_Constant);
-			u64 n = exact_value_to_u64(ce->args[1]->tav.value);
+			GB_ASSERT(ce->args[1]->tav().mode == Addressing_Constant);
+			u64 n = exact_value_to_u64(ce->args[1]->tav().value);
 			GB_ASSERT(max_count >= n);
 			GB_ASSERT(max_count % n == 0);
 
@@ -2651,7 +3024,7 @@ gb_internal lbValue lb_build_builtin_simd_proc(lbProcedure *p, Ast *expr, TypeAn
 			BigInt bi_count = {};
 			big_int_from_i64(&bi_count, count);
 
-			TypeAndValue const &tv = ce->args[1]->tav;
+			TypeAndValue const &tv = ce->args[1]->tav();
 			ExactValue val = exact_value_to_integer(tv.value);
 			GB_ASSERT(val.kind == ExactValue_Integer);
 			BigInt *bi = &val.value_integer;
@@ -3128,7 +3501,7 @@ gb_internal lbValue lb_build_builtin_proc(lbProcedure *p, Ast *expr, TypeAndValu
 	case BuiltinProc_compress_values: {
 		isize value_count = 0;
 		for (Ast *arg : ce->args) {
-			Type *t = arg->tav.type;
+			Type *t = arg->tav().type;
 			if (is_type_tuple(t)) {
 				value_count += t->Tuple.variables.count;
 			} else {
@@ -3870,16 +4243,16 @@ gb_internal lbValue lb_build_builtin_proc(lbProcedure *p, Ast *expr, TypeAndValu
 
 
 	case BuiltinProc_type_equal_proc:
-		return lb_equal_proc_for_type(p->module, ce->args[0]->tav.type);
+		return lb_equal_proc_for_type(p->module, ce->args[0]->tav().type);
 
 	case BuiltinProc_type_hasher_proc:
-		return lb_hasher_proc_for_type(p->module, ce->args[0]->tav.type);
+		return lb_hasher_proc_for_type(p->module, ce->args[0]->tav().type);
 
 	case BuiltinProc_type_map_info:
-		return lb_gen_map_info_ptr(p->module, ce->args[0]->tav.type);
+		return lb_gen_map_info_ptr(p->module, ce->args[0]->tav().type);
 
 	case BuiltinProc_type_map_cell_info:
-		return lb_gen_map_cell_info_ptr(p->module, ce->args[0]->tav.type);
+		return lb_gen_map_cell_info_ptr(p->module, ce->args[0]->tav().type);
 
 
 	case BuiltinProc_fixed_point_mul:
@@ -3971,7 +4344,7 @@ gb_internal lbValue lb_build_builtin_proc(lbProcedure *p, Ast *expr, TypeAndValu
 	case BuiltinProc_prefetch_write_data:
 		{
 			lbValue ptr = lb_emit_conv(p, lb_build_expr(p, ce->args[0]), t_rawptr);
-			unsigned long long locality = cast(unsigned long long)exact_value_to_i64(ce->args[1]->tav.value);
+			unsigned long long locality = cast(unsigned long long)exact_value_to_i64(ce->args[1]->tav().value);
 			unsigned long long rw = 0;
 			unsigned long long cache = 0;
 			switch (id) {
@@ -4759,6 +5132,18 @@ gb_internal lbValue lb_build_call_expr(lbProcedure *p, Ast *expr, lbValue *sret_
 	expr = unparen_expr(expr);
 	ast_node(ce, CallExpr, expr);
 
+	if (p->stack_make_calls.count != 0 && ptr_set_exists(&p->stack_make_calls, expr)) {
+		lbValue res = lb_build_stack_make(p, expr);
+		if (sret_dst != nullptr) {
+			lb_emit_store(p, *sret_dst, res);
+		}
+		return res;
+	}
+	if (p->stack_delete_calls.count != 0 && ptr_set_exists(&p->stack_delete_calls, expr)) {
+		// Nothing to free, `.None`
+		return lb_const_nil(p->module, type_of_expr(expr));
+	}
+
 	lbValue res = lb_build_call_expr_internal(p, expr, sret_dst);
 
 	if (ce->optional_ok_one) {
@@ -4830,8 +5215,8 @@ gb_internal lbValue lb_build_call_expr_internal(lbProcedure *p, Ast *expr, lbVal
 		}
 	}
 
-	if (proc_expr->tav.mode == Addressing_Constant) {
-		ExactValue v = proc_expr->tav.value;
+	if (proc_expr->tav().mode == Addressing_Constant) {
+		ExactValue v = proc_expr->tav().value;
 		switch (v.kind) {
 		case ExactValue_Integer:
 			{
@@ -4840,7 +5225,7 @@ gb_internal lbValue lb_build_call_expr_internal(lbProcedure *p, Ast *expr, lbVal
 				x.value = LLVMConstInt(lb_type(m, t_uintptr), u, false);
 				x.type = t_uintptr;
 				x = lb_emit_conv(p, x, t_rawptr);
-				value = lb_emit_conv(p, x, proc_expr->tav.type);
+				value = lb_emit_conv(p, x, proc_expr->tav().type);
 				break;
 			}
 		case ExactValue_Pointer:
@@ -4850,7 +5235,7 @@ gb_internal lbValue lb_build_call_expr_internal(lbProcedure *p, Ast *expr, lbVal
 				x.value = LLVMConstInt(lb_type(m, t_uintptr), u, false);
 				x.type = t_uintptr;
 				x = lb_emit_conv(p, x, t_rawptr);
-				value = lb_emit_conv(p, x, proc_expr->tav.type);
+				value = lb_emit_conv(p, x, proc_expr->tav().type);
 				break;
 			}
 		}
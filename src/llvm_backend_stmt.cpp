@@ -881,6 +881,42 @@ gb_internal Ast *lb_strip_and_prefix(Ast *ident) {
 
 
 
+gb_internal bool lb_switch_range_bounds(Ast *expr, i64 *lo_, i64 *hi_);
+
+gb_internal void lb_push_range_interval_bounds_fact(lbProcedure *p, Ast *val, Ast *interval, Scope *scope, lbBlock *preheader) {
+	ast_node(node, BinaryExpr, interval);
+
+	TypeAndValue lower = type_and_value_of_expr(node->left);
+	if (lower.mode != Addressing_Constant || lower.value.kind != ExactValue_Integer ||
+	    big_int_is_neg(&lower.value.value_integer)) {
+		return;
+	}
+
+	i64 lo = 0;
+	i64 hi = 0;
+	if (lb_switch_range_bounds(interval, &lo, &hi)) {
+		lb_push_bounds_fact(p, val, nullptr, hi, scope, preheader);
+		return;
+	}
+
+	// `for i in 0..<len(x)`
+	Ast *upper = unparen_expr(node->right);
+	if (node->op.kind != Token_RangeHalf || upper->kind != Ast_CallExpr) {
+		return;
+	}
+	ast_node(ce, CallExpr, upper);
+	Entity *proc_entity = entity_of_node(unparen_expr(ce->proc));
+	if (proc_entity == nullptr || proc_entity->kind != Entity_Builtin ||
+	    cast(BuiltinProcId)proc_entity->Builtin.id != BuiltinProc_len || ce->args.count != 1) {
+		return;
+	}
+	Type *array_type = base_type(type_of_expr(ce->args[0]));
+	if (is_type_cstring(array_type) || is_type_cstring16(array_type)) {
+		return;
+	}
+	lb_push_bounds_fact(p, val, lb_bounds_fact_entity(ce->args[0]), -1, scope, preheader);
+}
+
 gb_internal void lb_build_range_interval(lbProcedure *p, AstBinaryExpr *node,
                                          AstRangeStmt *rs, Scope *scope) {
 	bool ADD_EXTRA_WRAPPING_CHECK = true;
@@ -949,6 +985,7 @@ gb_internal void lb_build_range_interval(lbProcedure *p, AstBinaryExpr *node,
 		LLVMSetCurrentDebugLocation2(p->builder, lb_debug_location_from_ast(p, rs->label));
 		lb_add_debug_label(p, rs->label, label);
 	}
+	lbBlock *preheader = p->curr_block;
 	lb_emit_jump(p, loop);
 	lb_start_block(p, loop);
 
@@ -979,8 +1016,17 @@ gb_internal void lb_build_range_interval(lbProcedure *p, AstBinaryExpr *node,
 
 		lb_push_target_list(p, rs->label, done, continue_block, nullptr);
 
+		isize bounds_facts_count = p->bounds_facts.count;
+		isize bounds_guards_count = p->bounds_guards.count;
+		if (val0_type != nullptr) {
+			lb_push_range_interval_bounds_fact(p, val0, unparen_expr(rs->expr), scope, preheader);
+		}
+
 		lb_build_stmt(p, rs->body);
 
+		array_resize(&p->bounds_facts, bounds_facts_count);
+		array_resize(&p->bounds_guards, bounds_guards_count);
+
 		lb_close_scope(p, lbDeferExit_Default, nullptr, node->left);
 		lb_pop_target_list(p);
 
@@ -1327,6 +1373,8 @@ gb_internal void lb_build_range_stmt(lbProcedure *p, AstRangeStmt *rs, Scope *sc
 		lb_add_debug_label(p, rs->label, label);
 	}
 
+	lbBlock *preheader = p->curr_block;
+
 	if (tav.mode == Addressing_Type) {
 		lb_build_range_enum(p, type_deref(tav.type), val0_type, &val, &key, &loop, &done);
 	} else {
@@ -1493,8 +1541,28 @@ gb_internal void lb_build_range_stmt(lbProcedure *p, AstRangeStmt *rs, Scope *sc
 
 	lb_push_target_list(p, rs->label, done, loop, nullptr);
 
+	isize bounds_facts_count = p->bounds_facts.count;
+	isize bounds_guards_count = p->bounds_guards.count;
+	if (val1_type != nullptr && !is_map && tav.mode != Addressing_Type) {
+		// `for v, i in x`, the index is always within `x`
+		Type *et = base_type(type_deref(type_of_expr(expr)));
+		switch (et->kind) {
+		case Type_Array:
+			lb_push_bounds_fact(p, val1, lb_bounds_fact_entity(expr), et->Array.count, scope, preheader);
+			break;
+		case Type_Slice:
+		case Type_DynamicArray:
+		case Type_Basic:
+			lb_push_bounds_fact(p, val1, lb_bounds_fact_entity(expr), -1, scope, preheader);
+			break;
+		}
+	}
+
 	lb_build_stmt(p, rs->body);
 
+	array_resize(&p->bounds_facts, bounds_facts_count);
+	array_resize(&p->bounds_guards, bounds_guards_count);
+
 	lb_close_scope(p, lbDeferExit_Default, nullptr, rs->body);
 	lb_pop_target_list(p);
 	if (p->debug_info != nullptr) {
@@ -1548,11 +1616,11 @@ gb_internal void lb_build_unroll_range_stmt(lbProcedure *p, AstUnrollRangeStmt *
 		TokenKind op = expr->BinaryExpr.op.kind;
 		Ast *start_expr = expr->BinaryExpr.left;
 		Ast *end_expr   = expr->BinaryExpr.right;
-		GB_ASSERT(start_expr->tav.mode == Addressing_Constant);
-		GB_ASSERT(end_expr->tav.mode == Addressing_Constant);
+		GB_ASSERT(start_expr->tav().mode == Addressing_Constant);
+		GB_ASSERT(end_expr->tav().mode == Addressing_Constant);
 
-		ExactValue start = start_expr->tav.value;
-		ExactValue end   = end_expr->tav.value;
+		ExactValue start = start_expr->tav().value;
+		ExactValue end   = end_expr->tav().value;
 		if (op != Token_RangeHalf) { // .. [start, end] (or ..=)
 			ExactValue index = exact_value_i64(0);
 			for (ExactValue val = start;
@@ -1603,21 +1671,21 @@ gb_internal void lb_build_unroll_range_stmt(lbProcedure *p, AstUnrollRangeStmt *
 
 		ExactValue unroll_count_ev = {};
 		if (rs->args.count != 0) {
-			unroll_count_ev = rs->args[0]->tav.value;
+			unroll_count_ev = rs->args[0]->tav().value;
 		}
 
 
 		if (unroll_count_ev.kind == ExactValue_Invalid) {
 
-			Type *t = base_type(expr->tav.type);
+			Type *t = base_type(expr->tav().type);
 
 			switch (t->kind) {
 			case Type_Basic:
-				GB_ASSERT(expr->tav.mode == Addressing_Constant);
+				GB_ASSERT(expr->tav().mode == Addressing_Constant);
 
 				GB_ASSERT(is_type_string(t));
 				{
-					ExactValue value = expr->tav.value;
+					ExactValue value = expr->tav().value;
 					GB_ASSERT(value.kind == ExactValue_String);
 					String str = value.value_string;
 					Rune codepoint = 0;
@@ -1687,7 +1755,7 @@ gb_internal void lb_build_unroll_range_stmt(lbProcedure *p, AstUnrollRangeStmt *
 			i64 unroll_count = exact_value_to_i64(unroll_count_ev);
 			gb_unused(unroll_count);
 
-			Type *t = base_type(expr->tav.type);
+			Type *t = base_type(expr->tav().type);
 
 			lbValue data_ptr = {};
 			lbValue count_ptr = {};
@@ -1819,21 +1887,67 @@ gb_internal void lb_build_unroll_range_stmt(lbProcedure *p, AstUnrollRangeStmt *
 	lb_close_scope(p, lbDeferExit_Default, nullptr, rs->body);
 }
 
+// NOTE: Integer ranges in a `case` are expanded into individual `switch` cases, which LLVM then clusters back
+// into range checks, bit tests, or lookup tables. Past this many values the comparison chain is used instead.
+#define LB_SWITCH_JUMP_TABLE_MAX_RANGE_VALUES 1024
+
+gb_internal bool lb_switch_range_bounds(Ast *expr, i64 *lo_, i64 *hi_) {
+	ast_node(ie, BinaryExpr, expr);
+	TypeAndValue lhs = type_and_value_of_expr(ie->left);
+	TypeAndValue rhs = type_and_value_of_expr(ie->right);
+	if (lhs.mode != Addressing_Constant || lhs.value.kind != ExactValue_Integer ||
+	    rhs.mode != Addressing_Constant || rhs.value.kind != ExactValue_Integer) {
+		return false;
+	}
+
+	BigInt min_i64 = {};
+	BigInt max_i64 = {};
+	big_int_from_i64(&min_i64, INT64_MIN);
+	big_int_from_i64(&max_i64, INT64_MAX);
+	defer (big_int_dealloc(&min_i64));
+	defer (big_int_dealloc(&max_i64));
+
+	BigInt const *bounds[2] = {&lhs.value.value_integer, &rhs.value.value_integer};
+	for (BigInt const *v : bounds) {
+		if (big_int_cmp(v, &min_i64) < 0 || big_int_cmp(v, &max_i64) >= 0) {
+			return false;
+		}
+	}
+
+	// NOTE: `hi` is exclusive
+	*lo_ = big_int_to_i64(&lhs.value.value_integer);
+	*hi_ = big_int_to_i64(&rhs.value.value_integer);
+	if (ie->op.kind != Token_RangeHalf) {
+		*hi_ += 1;
+	}
+	if (*hi_ < *lo_) {
+		*hi_ = *lo_;
+	}
+	return true;
+}
+
 gb_internal bool lb_switch_stmt_can_be_trivial_jump_table(AstSwitchStmt *ss, bool *default_found_) {
 	if (ss->tag == nullptr) {
 		return false;
 	}
 	bool is_typeid = false;
 	TypeAndValue tv = type_and_value_of_expr(ss->tag);
+	Type *tag_type = tv.type;
 	if (is_type_integer(core_type(tv.type))) {
 		// okay
 	} else if (is_type_typeid(tv.type)) {
-		// okay
+		// NOTE: typeids are constant canonical type hashes, so a `switch` on them becomes a balanced
+		// decision tree rather than a linear chain of comparisons
+		if (build_context.no_rtti) {
+			return false;
+		}
 		is_typeid = true;
 	} else {
 		return false;
 	}
 
+	i64 range_values = 0;
+
 	ast_node(body, BlockStmt, ss->body);
 	for (Ast *clause : body->stmts) {
 		ast_node(cc, CaseClause, clause);
@@ -1846,9 +1960,24 @@ gb_internal bool lb_switch_stmt_can_be_trivial_jump_table(AstSwitchStmt *ss, boo
 		for (Ast *expr : cc->list) {
 			expr = unparen_expr(expr);
 			if (is_ast_range(expr)) {
-				return false;
+				if (is_typeid || is_type_different_to_arch_endianness(tag_type)) {
+					return false;
+				}
+				i64 lo = 0;
+				i64 hi = 0;
+				if (!lb_switch_range_bounds(expr, &lo, &hi)) {
+					return false;
+				}
+				if (cast(u64)hi - cast(u64)lo > LB_SWITCH_JUMP_TABLE_MAX_RANGE_VALUES) {
+					return false;
+				}
+				range_values += hi - lo;
+				if (range_values > LB_SWITCH_JUMP_TABLE_MAX_RANGE_VALUES) {
+					return false;
+				}
+				continue;
 			}
-			if (expr->tav.mode == Addressing_Type) {
+			if (expr->tav().mode == Addressing_Type) {
 				GB_ASSERT(is_typeid);
 				continue;
 			}
@@ -1863,13 +1992,200 @@ gb_internal bool lb_switch_stmt_can_be_trivial_jump_table(AstSwitchStmt *ss, boo
 
 	}
 
-	if (is_typeid) {
+	return true;
+}
+
+
+// NOTE: A `switch` on a `string` with enough constant cases is lowered to a jump on the length, followed by
+// a byte-trie on the most discriminating byte positions, and a single final comparison against the only
+// remaining candidate. This replaces the linear chain of `string_eq` calls.
+#define LB_STRING_SWITCH_MIN_CASES 4
+
+struct lbStringSwitchCase {
+	String   value;
+	lbBlock *body;
+};
+
+gb_internal GB_COMPARE_PROC(lb_string_switch_case_cmp) {
+	lbStringSwitchCase const *x = cast(lbStringSwitchCase const *)a;
+	lbStringSwitchCase const *y = cast(lbStringSwitchCase const *)b;
+	if (x->value.len != y->value.len) {
+		return x->value.len < y->value.len ? -1 : +1;
+	}
+	return string_compare(x->value, y->value);
+}
+
+gb_internal bool lb_switch_stmt_can_be_string_dispatch(AstSwitchStmt *ss) {
+	if (ss->tag == nullptr) {
+		return false;
+	}
+	TypeAndValue tv = type_and_value_of_expr(ss->tag);
+	Type *bt = base_type(tv.type);
+	if (bt == nullptr || bt->kind != Type_Basic || bt->Basic.kind != Basic_string) {
 		return false;
 	}
 
-	return true;
+	isize case_count = 0;
+	ast_node(body, BlockStmt, ss->body);
+	for (Ast *clause : body->stmts) {
+		ast_node(cc, CaseClause, clause);
+		for (Ast *expr : cc->list) {
+			expr = unparen_expr(expr);
+			if (is_ast_range(expr)) {
+				return false;
+			}
+			tv = type_and_value_of_expr(expr);
+			if (tv.mode != Addressing_Constant || tv.value.kind != ExactValue_String) {
+				return false;
+			}
+			case_count += 1;
+		}
+	}
+	return case_count >= LB_STRING_SWITCH_MIN_CASES;
+}
+
+gb_internal lbValue lb_emit_string_switch_equal(lbProcedure *p, lbValue data, String const &value) {
+	isize len = value.len;
+	GB_ASSERT(len > 0);
+
+	if (len > 16) {
+		lbValue str = lb_const_string(p->module, value);
+
+		auto args = array_make<lbValue>(temporary_allocator(), 3);
+		args[0] = lb_emit_conv(p, data, t_rawptr);
+		args[1] = lb_emit_conv(p, lb_string_elem(p, str), t_rawptr);
+		args[2] = lb_const_int(p->module, t_int, len);
+		return lb_emit_runtime_call(p, "memory_equal", args);
+	}
+
+	// NOTE: Short strings are compared inline against the case's bytes, with unaligned loads of `data`
+	return lb_emit_inline_memory_equal(p, data, {}, value.text, len, 1);
+}
+
+gb_internal void lb_build_string_switch_trie(lbProcedure *p, lbValue data, Slice<lbStringSwitchCase> cases, isize len, lbBlock *miss) {
+	GB_ASSERT(cases.count > 0);
+	if (cases.count == 1) {
+		lbStringSwitchCase const &c = cases[0];
+		if (len == 0) {
+			lb_emit_jump(p, c.body);
+		} else {
+			lbValue cond = lb_emit_string_switch_equal(p, data, c.value);
+			lb_emit_if(p, cond, c.body, miss);
+		}
+		return;
+	}
+
+	// Pick the byte position which splits the remaining candidates into the most groups
+	isize best_index = -1;
+	isize best_distinct = 1;
+	for (isize k = 0; k < len; k++) {
+		u8 seen[256] = {};
+		isize distinct = 0;
+		for (lbStringSwitchCase const &c : cases) {
+			u8 b = c.value.text[k];
+			if (!seen[b]) {
+				seen[b] = true;
+				distinct += 1;
+			}
+		}
+		if (distinct > best_distinct) {
+			best_index = k;
+			best_distinct = distinct;
+			if (distinct == cases.count) {
+				break;
+			}
+		}
+	}
+	GB_ASSERT_MSG(best_index >= 0, "duplicate string cases must be removed before building the trie");
+
+	// Counting sort by the byte at `best_index`, keeping each group contiguous
+	isize counts[257] = {};
+	for (lbStringSwitchCase const &c : cases) {
+		counts[cast(isize)c.value.text[best_index] + 1] += 1;
+	}
+	for (isize i = 1; i < gb_count_of(counts); i++) {
+		counts[i] += counts[i-1];
+	}
+	auto sorted = slice_make<lbStringSwitchCase>(temporary_allocator(), cases.count);
+	for (lbStringSwitchCase const &c : cases) {
+		sorted[counts[c.value.text[best_index]]++] = c;
+	}
+
+	lbValue byte_ptr = lb_emit_ptr_offset(p, data, lb_const_int(p->module, t_int, best_index));
+	lbValue byte = lb_emit_load(p, byte_ptr);
+	LLVMValueRef switch_instr = LLVMBuildSwitch(p->builder, byte.value, miss->block, cast(unsigned)best_distinct);
+
+	auto group_blocks = slice_make<lbBlock *>(temporary_allocator(), best_distinct);
+	auto group_starts = slice_make<isize>(temporary_allocator(), best_distinct+1);
+	isize group = 0;
+	for (isize i = 0; i < sorted.count; i++) {
+		u8 b = sorted[i].value.text[best_index];
+		if (i > 0 && b == sorted[i-1].value.text[best_index]) {
+			continue;
+		}
+		group_starts[group] = i;
+		group_blocks[group] = lb_create_block(p, "switch.string.byte");
+		LLVMAddCase(switch_instr, lb_const_int(p->module, t_u8, b).value, group_blocks[group]->block);
+		group += 1;
+	}
+	GB_ASSERT(group == best_distinct);
+	group_starts[group] = sorted.count;
+
+	for (isize g = 0; g < best_distinct; g++) {
+		lb_start_block(p, group_blocks[g]);
+		Slice<lbStringSwitchCase> sub = slice(sorted, group_starts[g], group_starts[g+1]);
+		lb_build_string_switch_trie(p, data, sub, len, miss);
+	}
 }
 
+gb_internal void lb_build_string_switch_dispatch(lbProcedure *p, lbValue tag, AstSwitchStmt *ss, Slice<lbBlock *> const &body_blocks, lbBlock *miss) {
+	ast_node(body, BlockStmt, ss->body);
+
+	StringSet seen = {};
+	string_set_init(&seen);
+	defer (string_set_destroy(&seen));
+
+	auto cases = array_make<lbStringSwitchCase>(temporary_allocator(), 0, body->stmts.count);
+	for_array(i, body->stmts) {
+		ast_node(cc, CaseClause, body->stmts[i]);
+		for (Ast *expr : cc->list) {
+			expr = unparen_expr(expr);
+			String value = expr->tav().value.value_string;
+			// NOTE: keep the first clause for a value, like the comparison chain would
+			if (string_set_update(&seen, value)) {
+				continue;
+			}
+			array_add(&cases, lbStringSwitchCase{value, body_blocks[i]});
+		}
+	}
+	array_sort(cases, lb_string_switch_case_cmp);
+
+	isize length_count = 0;
+	for_array(i, cases) {
+		if (i == 0 || cases[i].value.len != cases[i-1].value.len) {
+			length_count += 1;
+		}
+	}
+
+	lbValue tag_len  = lb_string_len(p, tag);
+	lbValue tag_data = lb_string_elem(p, tag);
+	LLVMValueRef switch_instr = LLVMBuildSwitch(p->builder, tag_len.value, miss->block, cast(unsigned)length_count);
+
+	for (isize lo = 0; lo < cases.count; /**/) {
+		isize len = cases[lo].value.len;
+		isize hi = lo+1;
+		while (hi < cases.count && cases[hi].value.len == len) {
+			hi += 1;
+		}
+
+		lbBlock *len_block = lb_create_block(p, "switch.string.len");
+		LLVMAddCase(switch_instr, lb_const_int(p->module, t_int, len).value, len_block->block);
+		lb_start_block(p, len_block);
+		lb_build_string_switch_trie(p, tag_data, slice(cases, lo, hi), len, miss);
+
+		lo = hi;
+	}
+}
 
 gb_internal void lb_build_switch_stmt(lbProcedure *p, AstSwitchStmt *ss, Scope *scope) {
 	lb_open_scope(p, scope);
@@ -1902,6 +2218,7 @@ gb_internal void lb_build_switch_stmt(lbProcedure *p, AstSwitchStmt *ss, Scope *
 
 	bool default_found = false;
 	bool is_trivial = lb_switch_stmt_can_be_trivial_jump_table(ss, &default_found);
+	bool is_string_dispatch = !is_trivial && lb_switch_stmt_can_be_string_dispatch(ss);
 
 	auto body_blocks = slice_make<lbBlock *>(permanent_allocator(), body->stmts.count);
 	for_array(i, body->stmts) {
@@ -1914,9 +2231,9 @@ gb_internal void lb_build_switch_stmt(lbProcedure *p, AstSwitchStmt *ss, Scope *
 			gbString bn = gb_string_make(heap_allocator(), "switch.case.");
 
 			Ast *first = cc->list[0];
-			if (first->tav.mode == Addressing_Type) {
+			if (first->tav().mode == Addressing_Type) {
 				bn = gb_string_appendc(bn, "type.");
-			} else if (is_type_rune(first->tav.type)) {
+			} else if (is_type_rune(first->tav().type)) {
 				bn = gb_string_appendc(bn, "rune.");
 			} else {
 				bn = gb_string_appendc(bn, "value.");
@@ -1927,12 +2244,17 @@ gb_internal void lb_build_switch_stmt(lbProcedure *p, AstSwitchStmt *ss, Scope *
 					bn = gb_string_appendc(bn, "..");
 				}
 
-				Ast *expr = cc->list[i];
-				if (expr->tav.mode == Addressing_Type) {
-					bn = write_type_to_string(bn, expr->tav.type, false);
+				Ast *expr = unparen_expr(cc->list[i]);
+				if (expr->tav().mode == Addressing_Type) {
+					bn = write_type_to_string(bn, expr->tav().type, false);
+				} else if (is_ast_range(expr)) {
+					ast_node(ie, BinaryExpr, expr);
+					bn = write_exact_value_to_string(bn, ie->left->tav().value, 1024);
+					bn = gb_string_append_length(bn, ie->op.string.text, ie->op.string.len);
+					bn = write_exact_value_to_string(bn, ie->right->tav().value, 1024);
 				} else {
-					ExactValue value = expr->tav.value;
-					if (is_type_rune(expr->tav.type) && value.kind == ExactValue_Integer) {
+					ExactValue value = expr->tav().value;
+					if (is_type_rune(expr->tav().type) && value.kind == ExactValue_Integer) {
 						Rune r = cast(Rune)exact_value_to_i64(value);
 						u8 rune_temp[6] = {};
 						isize size = gb_utf8_encode_rune(rune_temp, r);
@@ -1954,12 +2276,15 @@ gb_internal void lb_build_switch_stmt(lbProcedure *p, AstSwitchStmt *ss, Scope *
 
 
 	LLVMValueRef switch_instr = nullptr;
+	PtrSet<LLVMValueRef> switch_values = {};
+	defer (ptr_set_destroy(&switch_values));
 	if (is_trivial) {
 		isize num_cases = 0;
 		for (Ast *clause : body->stmts) {
 			ast_node(cc, CaseClause, clause);
 			num_cases += cc->list.count;
 		}
+		ptr_set_init(&switch_values, num_cases);
 
 		LLVMBasicBlockRef end_block = done->block;
 		if (default_block) {
@@ -1967,7 +2292,11 @@ gb_internal void lb_build_switch_stmt(lbProcedure *p, AstSwitchStmt *ss, Scope *
 		}
 
 		switch_instr = LLVMBuildSwitch(p->builder, tag.value, end_block, cast(unsigned)num_cases);
+	} else if (is_string_dispatch) {
+		lbBlock *miss = default_block ? default_block : done;
+		lb_build_string_switch_dispatch(p, tag, ss, body_blocks, miss);
 	}
+	bool has_dispatch = switch_instr != nullptr || is_string_dispatch;
 
 
 	for_array(i, body->stmts) {
@@ -1985,7 +2314,7 @@ gb_internal void lb_build_switch_stmt(lbProcedure *p, AstSwitchStmt *ss, Scope *
 			default_clause = clause;
 			default_stmts = cc->stmts;
 			default_fall  = fall;
-			if (switch_instr == nullptr) {
+			if (!has_dispatch) {
 				default_block = body;
 			} else {
 				GB_ASSERT(default_block != nullptr);
@@ -2002,21 +2331,42 @@ gb_internal void lb_build_switch_stmt(lbProcedure *p, AstSwitchStmt *ss, Scope *
 			expr = unparen_expr(expr);
 
 			if (switch_instr != nullptr) {
+				if (is_ast_range(expr)) {
+					i64 lo = 0;
+					i64 hi = 0;
+					bool ok = lb_switch_range_bounds(expr, &lo, &hi);
+					GB_ASSERT(ok);
+
+					LLVMTypeRef tag_type = lb_type(p->module, tag.type);
+					for (i64 v = lo; v < hi; v++) {
+						LLVMValueRef on_val = LLVMConstInt(tag_type, cast(unsigned long long)v, true);
+						if (!ptr_set_update(&switch_values, on_val)) {
+							LLVMAddCase(switch_instr, on_val, body->block);
+						}
+					}
+					continue;
+				}
+
 				lbValue on_val = {};
-				if (expr->tav.mode == Addressing_Type) {
+				if (expr->tav().mode == Addressing_Type) {
 					GB_ASSERT(is_type_typeid(tag.type));
-					lbValue e = lb_typeid(p->module, expr->tav.type);
+					lbValue e = lb_typeid(p->module, expr->tav().type);
 					on_val = lb_emit_conv(p, e, tag.type);
 				} else {
-					GB_ASSERT(expr->tav.mode == Addressing_Constant);
-					GB_ASSERT(!is_ast_range(expr));
+					GB_ASSERT(expr->tav().mode == Addressing_Constant);
 
 					on_val = lb_build_expr(p, expr);
 					on_val = lb_emit_conv(p, on_val, tag.type);
 				}
 
 				GB_ASSERT(LLVMIsConstant(on_val.value));
-				LLVMAddCase(switch_instr, on_val.value, body->block);
+				// NOTE: LLVM constants are uniqued, so this catches values repeated through overlapping
+				// ranges or distinct types which share a typeid; the first clause wins like the comparison chain
+				if (!ptr_set_update(&switch_values, on_val.value)) {
+					LLVMAddCase(switch_instr, on_val.value, body->block);
+				}
+				continue;
+			} else if (is_string_dispatch) {
 				continue;
 			}
 
@@ -2039,9 +2389,9 @@ gb_internal void lb_build_switch_stmt(lbProcedure *p, AstSwitchStmt *ss, Scope *
 				lbValue cond_rhs = lb_emit_comp(p, op, tag, rhs);
 				cond = lb_emit_arith(p, Token_And, cond_lhs, cond_rhs, t_bool);
 			} else {
-				if (expr->tav.mode == Addressing_Type) {
+				if (expr->tav().mode == Addressing_Type) {
 					GB_ASSERT(is_type_typeid(tag.type));
-					lbValue e = lb_typeid(p->module, expr->tav.type);
+					lbValue e = lb_typeid(p->module, expr->tav().type);
 					e = lb_emit_conv(p, e, tag.type);
 					cond = lb_emit_comp(p, Token_CmpEq, tag, e);
 				} else {
@@ -2061,13 +2411,13 @@ gb_internal void lb_build_switch_stmt(lbProcedure *p, AstSwitchStmt *ss, Scope *
 		lb_pop_target_list(p);
 
 		lb_emit_jump(p, done);
-		if (switch_instr == nullptr) {
+		if (!has_dispatch) {
 			lb_start_block(p, next_cond);
 		}
 	}
 
 	if (default_block != nullptr) {
-		if (switch_instr == nullptr) {
+		if (!has_dispatch) {
 			lb_emit_jump(p, default_block);
 		}
 		lb_start_block(p, default_block);
@@ -2378,14 +2728,14 @@ gb_internal void lb_build_static_variables(lbProcedure *p, AstValueDecl *vd) {
 		if (vd->values.count > 0) {
 			GB_ASSERT(vd->names.count == vd->values.count);
 			Ast *ast_value = vd->values[i];
-			GB_ASSERT(ast_value->tav.mode == Addressing_Constant ||
-			          ast_value->tav.mode == Addressing_Invalid);
+			GB_ASSERT(ast_value->tav().mode == Addressing_Constant ||
+			          ast_value->tav().mode == Addressing_Invalid);
 
 			auto cc = LB_CONST_CONTEXT_DEFAULT_NO_LOCAL;
 			if (e->Variable.is_rodata) {
 				cc.is_rodata = true;
 			}
-			value = lb_const_value(p->module, ast_value->tav.type, ast_value->tav.value, nullptr, cc);
+			value = lb_const_value(p->module, ast_value->tav().type, ast_value->tav().value, nullptr, cc);
 		}
 
 		String mangled_name = {};
@@ -3097,7 +3447,7 @@ gb_internal void lb_build_assign_stmt(lbProcedure *p, AstAssignStmt *as) {
 	op_ += Token_Add - Token_AddEq; // Convert += to +
 	TokenKind op = cast(TokenKind)op_;
 	if (op == Token_CmpAnd || op == Token_CmpOr) {
-		Type *type = as->lhs[0]->tav.type;
+		Type *type = as->lhs[0]->tav().type;
 		lbValue new_value = lb_emit_logical_binary_expr(p, op, as->lhs[0], as->rhs[0], type);
 
 		lbAddr lhs = lb_build_addr(p, as->lhs[0]);
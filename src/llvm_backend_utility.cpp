@@ -142,6 +142,64 @@ gb_internal void lb_mem_zero_ptr(lbProcedure *p, LLVMValueRef ptr, Type *type, u
 	}
 }
 
+// NOTE: Compares `size` bytes at `lhs` inline with (possibly overlapping) integer loads, e.g. 7 bytes are
+// checked with two 4 byte loads at offsets 0 and 3. The XOR differences are OR-reduced into a single compare,
+// which LLVM can turn into vector compares. The other side is loaded from `rhs`, or is the constant
+// `rhs_bytes` when that is not null. `align` is the known alignment of both sides.
+gb_internal lbValue lb_emit_inline_memory_equal(lbProcedure *p, lbValue lhs, lbValue rhs, u8 const *rhs_bytes, i64 size, i64 align) {
+	GB_ASSERT(size > 0);
+
+	i64 width = 1;
+	while (width < 8 && width*2 <= size) {
+		width *= 2;
+	}
+	LLVMTypeRef int_type = LLVMIntTypeInContext(p->module->ctx, cast(unsigned)(8*width));
+	bool is_big_endian = build_context.endian_kind == TargetEndian_Big;
+
+	lhs = lb_emit_conv(p, lhs, t_u8_ptr);
+	if (rhs_bytes == nullptr) {
+		rhs = lb_emit_conv(p, rhs, t_u8_ptr);
+	}
+
+	LLVMValueRef diff = nullptr;
+	for (i64 offset = 0; offset < size; offset += width) {
+		if (offset+width > size) {
+			// Overlap with the previous chunk rather than narrowing the loads
+			offset = size-width;
+		}
+		i64 load_align = gb_min(align, width);
+		while (load_align > 1 && (offset % load_align) != 0) {
+			load_align /= 2;
+		}
+
+		lbValue index = lb_const_int(p->module, t_int, offset);
+		LLVMValueRef l = OdinLLVMBuildLoadAligned(p, int_type, lb_emit_ptr_offset(p, lhs, index).value, load_align);
+		LLVMValueRef r = nullptr;
+		if (rhs_bytes != nullptr) {
+			u64 expected = 0;
+			for (i64 i = 0; i < width; i++) {
+				u64 b = cast(u64)rhs_bytes[offset+i];
+				if (is_big_endian) {
+					expected |= b << (8*(width-1-i));
+				} else {
+					expected |= b << (8*i);
+				}
+			}
+			r = LLVMConstInt(int_type, expected, false);
+		} else {
+			r = OdinLLVMBuildLoadAligned(p, int_type, lb_emit_ptr_offset(p, rhs, index).value, load_align);
+		}
+		LLVMValueRef x = LLVMBuildXor(p->builder, l, r, "");
+		diff = diff ? LLVMBuildOr(p->builder, diff, x, "") : x;
+	}
+	GB_ASSERT(diff != nullptr);
+
+	lbValue res = {};
+	res.type = t_llvm_bool;
+	res.value = LLVMBuildICmp(p->builder, LLVMIntEQ, diff, LLVMConstNull(int_type), "");
+	return res;
+}
+
 gb_internal lbValue lb_emit_select(lbProcedure *p, lbValue cond, lbValue x, lbValue y) {
 	cond = lb_emit_conv(p, cond, t_llvm_bool);
 	lbValue res = {};
@@ -2481,7 +2539,7 @@ gb_internal lbValue lb_handle_objc_ivar_for_objc_object_pointer(lbProcedure *p,
 gb_internal lbValue lb_handle_objc_ivar_get(lbProcedure *p, Ast *expr) {
 	ast_node(ce, CallExpr, expr);
 
-	GB_ASSERT(ce->args[0]->tav.type->kind == Type_Pointer);
+	GB_ASSERT(ce->args[0]->tav().type->kind == Type_Pointer);
 	lbValue self = lb_build_expr(p, ce->args[0]);
 
 	return lb_handle_objc_ivar_for_objc_object_pointer(p, self);
@@ -2915,7 +2973,7 @@ gb_internal lbValue lb_handle_objc_super(lbProcedure *p, Ast *expr) {
 gb_internal lbValue lb_handle_objc_find_selector(lbProcedure *p, Ast *expr) {
 	ast_node(ce, CallExpr, expr);
 
-	auto tav = ce->args[0]->tav;
+	auto tav = ce->args[0]->tav();
 	GB_ASSERT(tav.value.kind == ExactValue_String);
 	String name = tav.value.value_string;
 	return lb_addr_load(p, lb_handle_objc_find_or_register_selector(p, name));
@@ -2925,7 +2983,7 @@ gb_internal lbValue lb_handle_objc_register_selector(lbProcedure *p, Ast *expr)
 	ast_node(ce, CallExpr, expr);
 	lbModule *m = p->module;
 
-	auto tav = ce->args[0]->tav;
+	auto tav = ce->args[0]->tav();
 	GB_ASSERT(tav.value.kind == ExactValue_String);
 	String name = tav.value.value_string;
 	lbAddr dst = lb_handle_objc_find_or_register_selector(p, name);
@@ -2942,7 +3000,7 @@ gb_internal lbValue lb_handle_objc_register_selector(lbProcedure *p, Ast *expr)
 gb_internal lbValue lb_handle_objc_find_class(lbProcedure *p, Ast *expr) {
 	ast_node(ce, CallExpr, expr);
 
-	auto tav = ce->args[0]->tav;
+	auto tav = ce->args[0]->tav();
 	GB_ASSERT(tav.value.kind == ExactValue_String);
 	String name = tav.value.value_string;
 	return lb_addr_load(p, lb_handle_objc_find_or_register_class(p, name, nullptr));
@@ -2952,7 +3010,7 @@ gb_internal lbValue lb_handle_objc_register_class(lbProcedure *p, Ast *expr) {
 	ast_node(ce, CallExpr, expr);
 	lbModule *m = p->module;
 
-	auto tav = ce->args[0]->tav;
+	auto tav = ce->args[0]->tav();
 	GB_ASSERT(tav.value.kind == ExactValue_String);
 	String name = tav.value.value_string;
 	lbAddr dst = lb_handle_objc_find_or_register_class(p, name, nullptr);
@@ -2998,8 +3056,8 @@ gb_internal lbValue lb_handle_objc_send(lbProcedure *p, Ast *expr) {
 
 	lbValue id = lb_handle_objc_id(p, ce->args[1]);
 	Ast *sel_expr = ce->args[2];
-	GB_ASSERT(sel_expr->tav.value.kind == ExactValue_String);
-	lbValue sel = lb_addr_load(p, lb_handle_objc_find_or_register_selector(p, sel_expr->tav.value.value_string));
+	GB_ASSERT(sel_expr->tav().value.kind == ExactValue_String);
+	lbValue sel = lb_addr_load(p, lb_handle_objc_find_or_register_selector(p, sel_expr->tav().value.value_string));
 
 	array_add(&args, id);
 	array_add(&args, sel);
@@ -3045,7 +3103,7 @@ gb_internal lbValue lb_handle_objc_auto_send(lbProcedure *p, Ast *expr, Slice<lb
 
 	Type *objc_super_orig_type = nullptr;
 	if (ce->args.count > 0) {
-		objc_super_orig_type = unparen_expr(ce->args[0])->tav.objc_super_target;
+		objc_super_orig_type = unparen_expr(ce->args[0])->tav().objc_super_target;
 	}
 
 	isize arg_offset = 1;
@@ -3079,7 +3137,7 @@ gb_internal lbValue lb_handle_objc_auto_send(lbProcedure *p, Ast *expr, Slice<lb
 			//                the lhs-side to determine the class. This allows for class methods to be called
 			//                with the correct class as the target, even when the method is defined in a superclass.
 			ast_node(se, SelectorExpr, ce->proc);
-			GB_ASSERT(se->expr->tav.mode == Addressing_Type && se->expr->tav.type->kind == Type_Named);
+			GB_ASSERT(se->expr->tav().mode == Addressing_Type && se->expr->tav().type->kind == Type_Named);
 
 			objc_class = entity_from_expr(se->expr);
 			GB_ASSERT(objc_class);
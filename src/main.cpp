@@ -28,14 +28,12 @@ gb_internal void thread_pool_wait(void) {
 
 gb_internal i64 PRINT_PEAK_USAGE(void) {
 	if (build_context.show_more_timings) {
-	#if defined(GB_SYSTEM_WINDOWS)
-		PROCESS_MEMORY_COUNTERS p = {sizeof(p)};
-		if (GetProcessMemoryInfo(GetCurrentProcess(), &p, sizeof(p))) {
+		i64 peak = memory_peak_rss();
+		if (peak > 0) {
 			gb_printf("\n");
-			gb_printf("Peak Memory Size: %.3f MiB\n", (cast(f64)p.PeakWorkingSetSize) / cast(f64)(1024ull * 1024ull));
-			return cast(i64)p.PeakWorkingSetSize;
+			gb_printf("Peak Memory Size: %.3f MiB\n", (cast(f64)peak) / cast(f64)(1024ull * 1024ull));
+			return peak;
 		}
-	#endif
 	}
 	return 0;
 }
@@ -81,6 +79,115 @@ gb_global Timings global_timings = {0};
 
 #include "bug_report.cpp"
 
+#if defined(GB_SYSTEM_WINDOWS)
+#include <process.h>
+#else
+#include <spawn.h>
+extern char **environ;
+#endif
+
+#if defined(GB_SYSTEM_OSX) || defined(GB_SYSTEM_UNIX)
+// Splits a command line into its arguments following the POSIX shell quoting rules.
+// Returns false if the command line relies on any other shell feature (expansions, pipes,
+// redirections, globbing, etc), in which case it must still go through `system`.
+gb_internal bool system_split_command_line(char const *cmd_line, Array<char *> *args) {
+	gbString arg = nullptr;
+	for (char const *p = cmd_line; *p; p++) {
+		char c = *p;
+		if (c == ' ' || c == '\t') {
+			if (arg != nullptr) {
+				array_add(args, cast(char *)arg);
+				arg = nullptr;
+			}
+			continue;
+		}
+		if (arg == nullptr) {
+			arg = gb_string_make(heap_allocator(), "");
+		}
+
+		if (c == '\\') {
+			if (p[1] == 0 || p[1] == '\n') {
+				gb_string_free(arg);
+				return false;
+			}
+			p += 1;
+			arg = gb_string_append_length(arg, p, 1);
+		} else if (c == '\'') {
+			char const *end = strchr(p+1, '\'');
+			if (end == nullptr) {
+				gb_string_free(arg);
+				return false;
+			}
+			arg = gb_string_append_length(arg, p+1, end-(p+1));
+			p = end;
+		} else if (c == '"') {
+			for (p += 1; *p != '"'; p++) {
+				if (*p == 0 || *p == '$' || *p == '`') {
+					gb_string_free(arg);
+					return false;
+				}
+				if (*p == '\\') {
+					switch (p[1]) {
+					case '$': case '`': case '"': case '\\':
+						p += 1;
+						break;
+					case '\n':
+						gb_string_free(arg);
+						return false;
+					}
+				}
+				arg = gb_string_append_length(arg, p, 1);
+			}
+		} else if (gb_char_is_alphanumeric(c) || (cast(u8)c >= 0x80) || strchr("-_+=,./:@%^", c) != nullptr) {
+			arg = gb_string_append_length(arg, p, 1);
+		} else {
+			// NOTE: a shell metacharacter, e.g. `$`, `|`, `>`, `*`, `~`, `#`, `;`
+			gb_string_free(arg);
+			return false;
+		}
+	}
+	if (arg != nullptr) {
+		array_add(args, cast(char *)arg);
+	}
+	return args->count > 0;
+}
+
+// NOTE: Spawning the program directly avoids the extra `/bin/sh` process and its re-parsing of
+// the (potentially huge) command line that `system` requires. `status` has the same encoding
+// as the result of `system`.
+gb_internal bool system_exec_command_line_spawn(char const *cmd_line, i32 *status) {
+	auto args = array_make<char *>(heap_allocator(), 0, 64);
+	defer ({
+		for (char *arg : args) {
+			gb_string_free(cast(gbString)arg);
+		}
+		array_free(&args);
+	});
+
+	if (!system_split_command_line(cmd_line, &args)) {
+		return false;
+	}
+	array_add(&args, cast(char *)nullptr);
+
+	pid_t pid = 0;
+	if (posix_spawnp(&pid, args[0], nullptr, nullptr, args.data, environ) != 0) {
+		// NOTE: let `system` report the failure, e.g. the program not being found
+		return false;
+	}
+
+	int wstatus = 0;
+	while (waitpid(pid, &wstatus, 0) < 0) {
+		if (errno != EINTR) {
+			gb_printf_err("Could not wait on subprocess: (pid: %d): %s\n", pid, strerror(errno));
+			wstatus = -1;
+			break;
+		}
+	}
+	*status = cast(i32)wstatus;
+	return true;
+}
+#endif
+
 // NOTE(bill): 'name' is used in debugging and profiling modes
 gb_internal i32 system_exec_command_line_app_internal(bool exit_on_err, char const *name, char const *fmt, va_list va) {
 	isize const cmd_cap = 64<<20; // 64 MiB should be more than enough
@@ -152,7 +259,9 @@ gb_internal i32 system_exec_command_line_app_internal(bool exit_on_err, char con
 		gb_printf_err("[SYSTEM CALL] %s\n", name);
 		gb_printf_err("%s\n\n", cmd_line);
 	}
-	exit_code = system(cmd_line);
+	if (!system_exec_command_line_spawn(cmd_line, &exit_code)) {
+		exit_code = system(cmd_line);
+	}
 	if (exit_on_err && WIFSIGNALED(exit_code)) {
 		struct rlimit limit = { 0, 0, };
 		setrlimit(RLIMIT_CORE, &limit);
@@ -178,13 +287,6 @@ gb_internal i32 system_exec_command_line_app(char const *name, char const *fmt,
 	return exit_code;
 }
 
-#if defined(GB_SYSTEM_WINDOWS)
-#include <process.h>
-#else
-#include <spawn.h>
-extern char **environ;
-#endif
-
 int run_subprocess(const char *name, const char **args) {
 #if defined(GB_SYSTEM_WINDOWS)
 	return (int)_spawnv(_P_WAIT, name, args);
@@ -345,6 +447,8 @@ enum BuildFlagKind {
 	BuildFlag_Debug,
 	BuildFlag_DisableAssert,
 	BuildFlag_NoBoundsCheck,
+	BuildFlag_ShowBoundsChecks,
+	BuildFlag_ShowOptimizationRemarks,
 	BuildFlag_WebkitSwitchWorkaround,
 	BuildFlag_NoTypeAssert,
 	BuildFlag_NoDynamicLiterals,
@@ -353,6 +457,7 @@ enum BuildFlagKind {
 	BuildFlag_NoRPath,
 	BuildFlag_NoEntryPoint,
 	BuildFlag_Linker,
+	BuildFlag_LinkerThreadCount,
 	BuildFlag_UseSeparateModules,
 	BuildFlag_UseSingleModule,
 	BuildFlag_NoThreadedChecker,
@@ -446,8 +551,11 @@ enum BuildFlagKind {
 	BuildFlag_InternalLLVMVerification,
 	BuildFlag_InternalLLVMNoSROA,
 	BuildFlag_InternalEnableRVO,
+	BuildFlag_InternalInternerStats,
 
 	BuildFlag_Sanitize,
+	BuildFlag_PGOInstrument,
+	BuildFlag_PGOUse,
 	BuildFlag_LTO,
 
 #if defined(GB_SYSTEM_WINDOWS)
@@ -584,6 +692,8 @@ gb_internal bool parse_build_flags(Array<String> args) {
 	add_flag(&build_flags, BuildFlag_Debug,                   str_lit("debug"),                     BuildFlagParam_None,    Command__does_check);
 	add_flag(&build_flags, BuildFlag_DisableAssert,           str_lit("disable-assert"),            BuildFlagParam_None,    Command__does_check);
 	add_flag(&build_flags, BuildFlag_NoBoundsCheck,           str_lit("no-bounds-check"),           BuildFlagParam_None,    Command__does_check);
+	add_flag(&build_flags, BuildFlag_ShowBoundsChecks,        str_lit("show-bounds-checks"),        BuildFlagParam_None,    Command__does_build);
+	add_flag(&build_flags, BuildFlag_ShowOptimizationRemarks, str_lit("show-optimization-remarks"), BuildFlagParam_String,  Command__does_build);
 	add_flag(&build_flags, BuildFlag_WebkitSwitchWorkaround,  str_lit("webkit-switch-workaround"),  BuildFlagParam_None,    Command__does_check);
 	add_flag(&build_flags, BuildFlag_NoTypeAssert,            str_lit("no-type-assert"),            BuildFlagParam_None,    Command__does_check);
 	add_flag(&build_flags, BuildFlag_NoThreadLocal,           str_lit("no-thread-local"),           BuildFlagParam_None,    Command__does_check);
@@ -593,6 +703,7 @@ gb_internal bool parse_build_flags(Array<String> args) {
 	add_flag(&build_flags, BuildFlag_NoRPath,                 str_lit("no-rpath"),                  BuildFlagParam_None,    Command__does_build);
 	add_flag(&build_flags, BuildFlag_NoEntryPoint,            str_lit("no-entry-point"),            BuildFlagParam_None,    Command__does_check &~ Command_test);
 	add_flag(&build_flags, BuildFlag_Linker,                  str_lit("linker"),                    BuildFlagParam_String,  Command__does_build);
+	add_flag(&build_flags, BuildFlag_LinkerThreadCount,       str_lit("linker-thread-count"),       BuildFlagParam_Integer, Command__does_build);
 	add_flag(&build_flags, BuildFlag_UseSeparateModules,      str_lit("use-separate-modules"),      BuildFlagParam_None,    Command__does_build);
 	add_flag(&build_flags, BuildFlag_UseSingleModule,         str_lit("use-single-module"),         BuildFlagParam_None,    Command__does_build);
 	add_flag(&build_flags, BuildFlag_NoThreadedChecker,       str_lit("no-threaded-checker"),       BuildFlagParam_None,    Command__does_check);
@@ -684,9 +795,12 @@ gb_internal bool parse_build_flags(Array<String> args) {
 	add_flag(&build_flags, BuildFlag_InternalLLVMVerification, str_lit("internal-ignore-llvm-verification"), BuildFlagParam_None, Command_all);
 	add_flag(&build_flags, BuildFlag_InternalLLVMNoSROA,      str_lit("internal-llvm-no-sroa"), BuildFlagParam_None, Command_all);
 	add_flag(&build_flags, BuildFlag_InternalEnableRVO,       str_lit("internal-enable-rvo"), BuildFlagParam_None, Command_all);
+	add_flag(&build_flags, BuildFlag_InternalInternerStats,   str_lit("internal-interner-stats"), BuildFlagParam_None, Command_all);
 
 
 	add_flag(&build_flags, BuildFlag_Sanitize,                str_lit("sanitize"),                  BuildFlagParam_String,  Command__does_build, true);
+	add_flag(&build_flags, BuildFlag_PGOInstrument,           str_lit("pgo-instrument"),            BuildFlagParam_None,    Command__does_build);
+	add_flag(&build_flags, BuildFlag_PGOUse,                  str_lit("pgo-use"),                   BuildFlagParam_String,  Command__does_build);
 	add_flag(&build_flags, BuildFlag_LTO,                     str_lit("lto"),                       BuildFlagParam_String,  Command__does_build);
 
 
@@ -1280,6 +1394,65 @@ gb_internal bool parse_build_flags(Array<String> args) {
 						case BuildFlag_NoBoundsCheck:
 							build_context.no_bounds_check = true;
 							break;
+						case BuildFlag_ShowBoundsChecks:
+							build_context.show_bounds_checks = true;
+							break;
+						case BuildFlag_ShowOptimizationRemarks: {
+							GB_ASSERT(value.kind == ExactValue_String);
+							String filter = string_trim_whitespace(value.value_string);
+							if (filter.len == 0) {
+								filter = str_lit("all");
+							}
+
+							gbString pattern = gb_string_make(heap_allocator(), "");
+							String_Iterator it = {filter, 0};
+							for (;;) {
+								String name = string_split_iterator(&it, ',');
+								if (name.len == 0) {
+									break;
+								}
+								name = string_trim_whitespace(name);
+
+								char const *passes = nullptr;
+								if (name == "all") {
+									passes = ".*";
+									build_context.show_bounds_checks = true;
+									build_context.show_stack_promotions = true;
+								} else if (name == "vectorize") {
+									passes = "loop-vectorize|slp-vectorizer";
+								} else if (name == "inline") {
+									passes = "inline";
+								} else if (name == "bounds") {
+									// NOTE: LLVM folds the remaining checks in generic passes which do not report them as such
+									build_context.show_bounds_checks = true;
+									continue;
+								} else if (name == "stack") {
+									build_context.show_stack_promotions = true;
+									continue;
+								} else {
+									for (isize i = 0; i < name.len; i++) {
+										u8 c = name[i];
+										if (!gb_char_is_alphanumeric(c) && c != '-' && c != '_' && c != '.' && c != '*') {
+											gb_printf_err("Invalid -show-optimization-remarks filter '%.*s'\n", LIT(name));
+											gb_printf_err("Expected one of 'all', 'vectorize', 'inline', 'bounds', 'stack', or an LLVM pass name\n");
+											bad_flags = true;
+											break;
+										}
+									}
+								}
+
+								if (gb_string_length(pattern) != 0) {
+									pattern = gb_string_appendc(pattern, "|");
+								}
+								if (passes != nullptr) {
+									pattern = gb_string_appendc(pattern, passes);
+								} else {
+									pattern = gb_string_append_length(pattern, name.text, name.len);
+								}
+							}
+							build_context.optimization_remarks_filter = make_string(cast(u8 *)pattern, gb_string_length(pattern));
+							break;
+						}
 						case BuildFlag_WebkitSwitchWorkaround:
 							build_context.webkit_switch_workaround = true;
 							break;
@@ -1327,6 +1500,17 @@ gb_internal bool parse_build_flags(Array<String> args) {
 								}
 							}
 							break;
+						case BuildFlag_LinkerThreadCount: {
+							GB_ASSERT(value.kind == ExactValue_Integer);
+							isize count = cast(isize)big_int_to_i64(&value.value_integer);
+							if (count <= 0) {
+								gb_printf_err("%.*s expected a positive non-zero number, got %.*s\n", LIT(name), LIT(param));
+								bad_flags = true;
+							} else {
+								build_context.linker_thread_count = count;
+							}
+							break;
+						}
 
 
 						case BuildFlag_UseSeparateModules:
@@ -1719,6 +1903,9 @@ gb_internal bool parse_build_flags(Array<String> args) {
 						case BuildFlag_InternalEnableRVO:
 							build_context.enable_rvo = true;
 							break;
+						case BuildFlag_InternalInternerStats:
+							build_context.internal_interner_stats = true;
+							break;
 
 
 						case BuildFlag_Sanitize:
@@ -1741,6 +1928,33 @@ gb_internal bool parse_build_flags(Array<String> args) {
 							}
 							break;
 
+						case BuildFlag_PGOInstrument:
+							GB_ASSERT(value.kind == ExactValue_Invalid);
+							if (build_context.pgo_use_path.len != 0) {
+								gb_printf_err("-pgo-instrument cannot be used with -pgo-use:<string>\n");
+								bad_flags = true;
+							}
+							build_context.pgo_instrument = true;
+							break;
+						case BuildFlag_PGOUse: {
+							GB_ASSERT(value.kind == ExactValue_String);
+							String path = string_trim_whitespace(value.value_string);
+							if (build_context.pgo_instrument) {
+								gb_printf_err("-pgo-use:<string> cannot be used with -pgo-instrument\n");
+								bad_flags = true;
+							} else if (!is_build_flag_path_valid(path)) {
+								gb_printf_err("Invalid -pgo-use path, got %.*s\n", LIT(path));
+								bad_flags = true;
+							} else {
+								build_context.pgo_use_path = path_to_full_path(heap_allocator(), path);
+								if (!gb_file_exists(cast(char const *)build_context.pgo_use_path.text)) {
+									gb_printf_err("-pgo-use profile does not exist: %.*s\n", LIT(build_context.pgo_use_path));
+									bad_flags = true;
+								}
+							}
+							break;
+						}
+
 						case BuildFlag_LTO:
 							GB_ASSERT(value.kind == ExactValue_String);
 							if (str_eq_ignore_case(value.value_string, str_lit("thin"))) {
@@ -2262,6 +2476,11 @@ gb_internal void show_timings(Checker *c, Timings *t) {
 
 	timings_print_all(t);
 
+	if (build_context.show_more_timings && p->front_end_bytes_released > 0) {
+		gb_printf_err("\n");
+		gb_printf_err("Front-end memory released before code generation: %.3f MiB\n", cast(f64)p->front_end_bytes_released / cast(f64)(1024ull * 1024ull));
+	}
+
 	PRINT_PEAK_USAGE();
 
 	if (!(build_context.export_timings_format == TimingsExportUnspecified)) {
@@ -2524,8 +2743,8 @@ gb_internal void export_linked_libraries(LinkerData *gen) {
 			gb_fprintf(&f, "\t");
 
 			Ast *file_path = imp->filepaths[i];
-			GB_ASSERT(file_path->tav.mode == Addressing_Constant && file_path->tav.value.kind == ExactValue_String);
-			String file_path_str = file_path->tav.value.value_string;
+			GB_ASSERT(file_path->tav().mode == Addressing_Constant && file_path->tav().value.kind == ExactValue_String);
+			String file_path_str = file_path->tav().value.value_string;
 
 			if (string_starts_with(file_path_str, str_lit("system:"))) {
 				gb_fprintf(&f, "system");
@@ -2947,6 +3166,12 @@ gb_internal int print_show_help(String const arg0, String command, String option
 			}
 		}
 
+		if (print_flag("-linker-thread-count:<integer>")) {
+			print_usage_line(2, "Sets the number of threads the linker may use (lld, mold and wasm-ld).");
+			print_usage_line(2, "Also sets the number of ThinLTO backend jobs when used with -lto:<string>.");
+			print_usage_line(2, "If not set, the linker's own default is used.");
+		}
+
 		if (print_flag("-lto:<string>")) {
 			print_usage_line(2, "States that the project is to be build with link-time optimizations.");
 			print_usage_line(2, "This also enables '-use-separate-modules' (if not already set) and `-linker:lld");
@@ -3000,6 +3225,23 @@ gb_internal int print_show_help(String const arg0, String command, String option
 			print_usage_line(2, "Disables bounds checking program wide.");
 		}
 
+		if (print_flag("-show-bounds-checks")) {
+			print_usage_line(2, "Reports every index bounds check after code generation, and whether it was kept, hoisted out of its loop, or proven redundant.");
+		}
+
+		if (print_flag("-show-optimization-remarks:<filter>")) {
+			print_usage_line(2, "Reports what LLVM's optimization passes did and did not do, such as why a loop was not vectorized.");
+			print_usage_line(2, "Source locations are only known with -debug.");
+			print_usage_line(2, "Available filters, separated by commas:");
+			print_usage_line(3, "-show-optimization-remarks:all");
+			print_usage_line(3, "-show-optimization-remarks:vectorize");
+			print_usage_line(3, "-show-optimization-remarks:inline");
+			print_usage_line(3, "-show-optimization-remarks:bounds  (same as -show-bounds-checks)");
+			print_usage_line(3, "-show-optimization-remarks:stack   (which 'make([]T, N)' calls were placed on the stack)");
+			print_usage_line(3, "-show-optimization-remarks:<llvm-pass-name>");
+			print_usage_line(2, "Example: -show-optimization-remarks:vectorize,inline");
+		}
+
 		if (print_flag("-webkit-switch-workaround")) {
 			print_usage_line(2, "Constrains 'typeid' values to 63 bits to avoid an OMG JIT crash in WebKit when running WASM builds.");
 			print_usage_line(2, "Only needed for 'js_wasm32'/'js_wasm64p32' targets run in Safari/WebKit. See: https://github.com/odin-lang/Odin/issues/6810");
@@ -3123,6 +3365,18 @@ gb_internal int print_show_help(String const arg0, String command, String option
 				print_usage_line(3, "-sanitize:memory");
 				print_usage_line(3, "-sanitize:thread");
 		}
+
+		if (print_flag("-pgo-instrument")) {
+			print_usage_line(2, "Instruments the program for profile-guided optimization and links the profile runtime.");
+			print_usage_line(2, "Running the program writes a .profraw file (see the LLVM_PROFILE_FILE environment variable)");
+			print_usage_line(2, "which must be merged with `llvm-profdata merge -o <file.profdata> <files.profraw>`.");
+		}
+
+		if (print_flag("-pgo-use:<string>")) {
+			print_usage_line(2, "Optimizes the program using the given profile, produced by a -pgo-instrument build.");
+			print_usage_line(2, "The program must be built with the same compiler and flags as the instrumented one.");
+			print_usage_line(2, "Example: -pgo-use:server.profdata");
+		}
 	}
 
 	if (doc) {
@@ -3157,6 +3411,7 @@ gb_internal int print_show_help(String const arg0, String command, String option
 
 		if (print_flag("-show-more-timings")) {
 			print_usage_line(2, "Shows an advanced overview of the timings of different stages within the compiler in milliseconds.");
+			print_usage_line(2, "Also shows the peak and current memory usage at the end of each stage, split by arena and allocator.");
 		}
 	}
 
@@ -3966,6 +4221,7 @@ int main(int arg_count, char const **arg_ptr) {
 	if (!parse_build_flags(args)) {
 		return 1;
 	}
+	global_timings.track_memory = build_context.show_more_timings;
 
 	if (build_context.show_help) {
 		return print_show_help(args[0], command);
@@ -4276,6 +4532,10 @@ int main(int arg_count, char const **arg_ptr) {
 	if (!build_context.ignore_unused_defineables) {
 		check_defines(&build_context, checker);
 	}
+	thread_pool_free_arenas(&global_thread_pool, ThreadArena_Checking);
+	if (build_context.internal_interner_stats) {
+		string_interner_print_stats();
+	}
 	if (any_errors()) {
 		print_all_errors();
 		return 1;
@@ -4345,6 +4605,13 @@ int main(int arg_count, char const **arg_ptr) {
 		failed_to_cache_parsing = true;
 	}
 
+	{
+		// NOTE: the documentation and source rewriting paths have already returned above,
+		// so the parser's token arrays are no longer needed during the LLVM stage
+		MAIN_TIME_SECTION("release front-end memory");
+		release_front_end_memory(parser);
+	}
+
 	{
 		lbGenerator *gen = permanent_alloc_item<lbGenerator>();
 		if (!lb_init_generator(gen, checker)) {
@@ -4357,6 +4624,13 @@ int main(int arg_count, char const **arg_ptr) {
 		}
 		MAIN_TIME_SECTION_WITH_LEN(label_code_gen, gb_string_length(label_code_gen));
 		if (lb_generate_code(gen)) {
+			if (build_context.show_bounds_checks) {
+				lb_print_bounds_check_report();
+			}
+			if (build_context.optimization_remarks_filter.len != 0 || build_context.show_stack_promotions) {
+				lb_print_optimization_remarks(gen);
+			}
+
 			switch (build_context.build_mode) {
 			case BuildMode_Executable:
 			case BuildMode_StaticLibrary:
@@ -141,8 +141,10 @@ gb_internal isize ast_node_size(AstKind kind) {
 // NOTE(bill): And this below is why is I/we need a new language! Discriminated unions are a pain in C/C++
 gb_internal Ast *alloc_ast_node(AstFile *f, AstKind kind) {
 	isize size = ast_node_size(kind);
+	isize prefix = ast_kind_has_tav(kind) ? AST_TAV_PREFIX_SIZE : 0;
 
-	Ast *node = cast(Ast *)arena_alloc(get_arena(ThreadArena_Permanent), size, 16);
+	u8 *data = cast(u8 *)arena_alloc(get_arena(ThreadArena_Permanent), prefix + size, 16);
+	Ast *node = cast(Ast *)(data + prefix);
 	node->kind = kind;
 	node->file_id = f ? f->id : 0;
 
@@ -186,6 +188,9 @@ gb_internal Ast *clone_ast(Ast *node, AstFile *f) {
 	}
 	Ast *n = alloc_ast_node(f, node->kind);
 	gb_memmove(n, node, ast_node_size(node->kind));
+	if (ast_kind_has_tav(n->kind)) {
+		n->tav() = node->tav();
+	}
 
 	switch (n->kind) {
 	default: GB_PANIC("Unhandled Ast %.*s", LIT(ast_strings[n->kind])); break;
@@ -840,8 +845,8 @@ gb_internal String string_value_from_token(AstFile *f, Token const &token) {
 gb_internal Ast *ast_basic_lit(AstFile *f, Token basic_lit) {
 	Ast *result = alloc_ast_node(f, Ast_BasicLit);
 	result->BasicLit.token = basic_lit;
-	result->tav.mode = Addressing_Constant;
-	result->tav.value = exact_value_from_token(f, basic_lit);
+	result->tav().mode = Addressing_Constant;
+	result->tav().value = exact_value_from_token(f, basic_lit);
 	return result;
 }
 
@@ -5744,7 +5749,9 @@ gb_internal ParseFileError init_ast_file(AstFile *f, String const &fullpath, Tok
 	token_cap = ((token_cap + pow2_cap-1)/pow2_cap) * pow2_cap;
 
 	isize init_token_cap = gb_max(token_cap, 16);
-	array_init(&f->tokens, ast_allocator(f), 0, gb_max(init_token_cap, 16));
+	// NOTE: tokens and the raw comment list live on the heap rather than the permanent arena
+	// so that they can be released before code generation, see `release_front_end_memory`
+	array_init(&f->tokens, heap_allocator(), 0, gb_max(init_token_cap, 16));
 
 	if (err == TokenizerInit_Empty) {
 		Token token = {Token_EOF};
@@ -5779,7 +5786,7 @@ gb_internal ParseFileError init_ast_file(AstFile *f, String const &fullpath, Tok
 	f->prev_token = f->tokens[f->prev_token_index];
 	f->curr_token = f->tokens[f->curr_token_index];
 
-	array_init(&f->comments, ast_allocator(f), 0, 0);
+	array_init(&f->comments, heap_allocator(), 0, 0);
 	array_init(&f->imports,  ast_allocator(f), 0, 0);
 
 	f->curr_proc = nullptr;
@@ -5794,6 +5801,26 @@ gb_internal void destroy_ast_file(AstFile *f) {
 	array_free(&f->imports);
 }
 
+// NOTE: Once checking has finished, nothing on the code generation path reads the token arrays or
+// the raw comment lists of a file. Comment groups which are attached to declarations (`docs`) are
+// separate allocations and stay alive. The source buffers are kept, as token and identifier strings
+// point directly into them.
+gb_internal void release_front_end_memory(Parser *p) {
+	isize released = 0;
+	for (AstPackage *pkg : p->packages) {
+		for (AstFile *file : pkg->files) {
+			released += file->tokens.capacity   * gb_size_of(Token);
+			released += file->comments.capacity * gb_size_of(CommentGroup *);
+
+			array_free(&file->tokens);
+			array_free(&file->comments);
+			file->tokens   = {};
+			file->comments = {};
+		}
+	}
+	p->front_end_bytes_released += released;
+}
+
 gb_internal bool init_parser(Parser *p) {
 	GB_ASSERT(p != nullptr);
 	string_set_init(&p->imported_files);
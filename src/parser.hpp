@@ -236,6 +236,8 @@ struct Parser {
 
 	std::atomic<isize>     total_seen_load_directive_count;
 
+	isize                  front_end_bytes_released; // by `release_front_end_memory`, shown with -show-more-timings
+
 	// TODO(bill): What should this mutex be per?
 	//  * Parser
 	//  * Package
@@ -872,15 +874,22 @@ struct AstCommonStuff {
 	u8              state_flags;
 	std::atomic<u8> viral_state_flags;
 	i32             file_id;
-	TypeAndValue    tav; // NOTE(bill): Making this a pointer is slower
 };
 
+#define AST_TAV_PREFIX_SIZE gb_size_of(TypeAndValue)
+GB_STATIC_ASSERT(AST_TAV_PREFIX_SIZE % gb_align_of(void *) == 0);
+
+// NOTE: Only expressions, types and the miscellaneous nodes (fields, attributes) are ever typed.
+// Statements and declarations are allocated without a `TypeAndValue`, see `alloc_ast_node`
+gb_internal gb_inline bool ast_kind_has_tav(AstKind kind) {
+	return kind < Ast__StmtBegin || kind > Ast__DeclEnd;
+}
+
 struct Ast {
 	AstKind         kind; // u16
 	u8              state_flags;
 	std::atomic<u8> viral_state_flags;
 	i32             file_id;
-	TypeAndValue    tav; // NOTE(bill): Making this a pointer is slower
 
 	// IMPORTANT NOTE(bill): This must be at the end since the AST is allocated to be size of the variant
 	union {
@@ -899,6 +908,16 @@ struct Ast {
 	gb_inline AstFile *thread_safe_file() const {
 		return thread_safe_get_ast_file_from_id(this->file_id);
 	}
+
+	// NOTE: The `TypeAndValue` is stored directly in front of the node rather than behind a pointer
+	// (which was slower), so nodes which are never typed do not pay for it. The kind check is only done in
+	// debug builds as this is called for nearly every node the checker touches
+	gb_inline TypeAndValue &tav() {
+		#if defined(_DEBUG)
+		GB_ASSERT_MSG(ast_kind_has_tav(this->kind), "'%.*s' has no TypeAndValue", LIT(ast_strings[this->kind]));
+		#endif
+		return *cast(TypeAndValue *)(cast(u8 *)this - AST_TAV_PREFIX_SIZE);
+	}
 };
 
 
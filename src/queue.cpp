@@ -21,6 +21,9 @@ template <typename T> gb_internal void  mpsc_destroy(MPSCQueue<T> *q);
 template <typename T> gb_internal isize mpsc_enqueue(MPSCQueue<T> *q, T const &value);
 template <typename T> gb_internal bool  mpsc_dequeue(MPSCQueue<T> *q, T *value_);
 
+template <typename T> gb_internal MPSCNode<T> *mpsc_alloc_nodes  (MPSCQueue<T> *q, isize count);
+template <typename T> gb_internal isize        mpsc_enqueue_nodes(MPSCQueue<T> *q, MPSCNode<T> *nodes, isize count);
+
 template <typename T>
 gb_internal void mpsc_init(MPSCQueue<T> *q, gbAllocator const &allocator) {
 	q->sentinel.next.store(nullptr, std::memory_order_relaxed);
@@ -63,6 +66,30 @@ gb_internal isize mpsc_enqueue(MPSCQueue<T> *q, T const &value) {
 }
 
 
+// NOTE: Allocates `count` contiguous nodes for `mpsc_enqueue_nodes`; the caller fills in their values
+template <typename T>
+gb_internal MPSCNode<T> *mpsc_alloc_nodes(MPSCQueue<T> *q, isize count) {
+	return permanent_alloc_array<MPSCNode<T> >(count);
+}
+
+// NOTE: Publishes a whole batch of nodes with a single exchange on the head, rather than one per value.
+// The batch is linked up before it becomes visible, so the consumer never sees a partial chain.
+template <typename T>
+gb_internal isize mpsc_enqueue_nodes(MPSCQueue<T> *q, MPSCNode<T> *nodes, isize count) {
+	if (count <= 0) {
+		return q->count.load(std::memory_order_relaxed);
+	}
+	for (isize i = 0; i < count-1; i++) {
+		nodes[i].next.store(&nodes[i+1], std::memory_order_relaxed);
+	}
+	MPSCNode<T> *last = &nodes[count-1];
+	last->next.store(nullptr, std::memory_order_relaxed);
+
+	auto prev = q->head.exchange(last, std::memory_order_acq_rel);
+	prev->next.store(&nodes[0], std::memory_order_release);
+	return count + q->count.fetch_add(count, std::memory_order_relaxed);
+}
+
 template <typename T>
 gb_internal bool mpsc_dequeue(MPSCQueue<T> *q, T *value_) {
 	auto tail = q->tail.load(std::memory_order_relaxed);
@@ -0,0 +1,305 @@
+struct Entity;
+
+struct ScopeMapSlot {
+	u32            hash;
+	InternedString key;
+	Entity *       value;
+};
+
+// NOTE: ScopeMap is a Swiss table: every slot has a control byte which is either 0 (empty) or
+// 0x80 | the top 7 bits of the hash. Lookups compare a whole group of 16 control bytes at once
+// (SSE2 on x86-64, SWAR elsewhere) and only touch the slots of the matching bytes. Entries are
+// never removed, so there are no tombstones and an empty byte in a group ends a probe.
+// `slots[i].hash != 0` still marks a used slot for the code which walks the slots directly.
+enum { SCOPE_MAP_GROUP_WIDTH = 16 };
+enum { SCOPE_MAP_INLINE_CAP = SCOPE_MAP_GROUP_WIDTH };
+
+struct ScopeMap {
+	ScopeMapSlot    inline_slots[SCOPE_MAP_INLINE_CAP];
+	u8              inline_ctrl [SCOPE_MAP_INLINE_CAP];
+	ScopeMapSlot *  slots;
+	u8 *            ctrl;
+	u32             count;
+	u32             cap;
+};
+
+// NOTE: SCOPE_MAP_NO_SIMD forces the SWAR fallback, e.g. to benchmark or test it on x86. The NEON group
+// match is opt-in with SCOPE_MAP_ENABLE_NEON until it has been measured on arm64 hardware, so arm64 builds
+// use the SWAR fallback by default; CI checks both with tests/benchmark/compiler/scope_map.cpp
+#if defined(SCOPE_MAP_NO_SIMD)
+#elif defined(GB_CPU_X86) && defined(GB_ARCH_64_BIT)
+#define SCOPE_MAP_USE_SSE2 1
+#include <emmintrin.h>
+#elif defined(SCOPE_MAP_ENABLE_NEON) && defined(GB_CPU_ARM) && defined(GB_ARCH_64_BIT)
+#define SCOPE_MAP_USE_NEON 1
+#include <arm_neon.h>
+#endif
+
+// NOTE: A group mask has one set bit per matching control byte. With NEON there is no movemask,
+// so every control byte owns a nibble of a u64 instead and the bit index is shifted down by 2.
+#if defined(SCOPE_MAP_USE_NEON)
+typedef u64 ScopeMapGroupMask;
+enum { SCOPE_MAP_GROUP_MASK_SHIFT = 2 };
+#else
+typedef u32 ScopeMapGroupMask;
+enum { SCOPE_MAP_GROUP_MASK_SHIFT = 0 };
+#endif
+
+gb_internal gb_inline u8 scope_map_ctrl_tag(u32 hash) {
+	return cast(u8)(0x80 | (hash >> 25));
+}
+
+// Returns a bit per control byte in the group which is equal to `tag`
+gb_internal gb_inline ScopeMapGroupMask scope_map_group_match(u8 const *group, u8 tag) {
+#if defined(SCOPE_MAP_USE_SSE2)
+	__m128i ctrl = _mm_loadu_si128(cast(__m128i const *)group);
+	return cast(u32)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(cast(char)tag)));
+#elif defined(SCOPE_MAP_USE_NEON)
+	// NOTE: the narrowing shift packs each 0x00/0xff lane of the compare into a 4-bit nibble,
+	// one bit of which is kept so that `mask &= mask-1` steps over whole bytes
+	uint8x16_t eq = vceqq_u8(vld1q_u8(group), vdupq_n_u8(tag));
+	uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+	return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & 0x8888888888888888ull;
+#else
+	// NOTE: SWAR fallback, 8 control bytes at a time; the multiply gathers the high bit of each byte
+	u64 const lo7   = 0x7f7f7f7f7f7f7f7full;
+	u64 const ones  = 0x0101010101010101ull;
+	u64 const magic = 0x0102040810204080ull;
+	u32 mask = 0;
+	for (u32 half = 0; half < 2; half++) {
+		u64 word = 0;
+		memcpy(&word, group + 8*half, 8);
+		u64 x = word ^ (ones * tag);
+		u64 eq = ~(((x & lo7) + lo7) | x | lo7);
+		mask |= cast(u32)(((eq >> 7) * magic) >> 56) << (8*half);
+	}
+	return mask;
+#endif
+}
+
+gb_internal gb_inline ScopeMapGroupMask scope_map_group_match_empty(u8 const *group) {
+	return scope_map_group_match(group, 0);
+}
+
+// Returns the index within the group of the lowest matching control byte
+gb_internal gb_inline u32 scope_map_lowest_set_bit(ScopeMapGroupMask mask) {
+#if defined(SCOPE_MAP_USE_NEON)
+	#if defined(GB_COMPILER_MSVC)
+		unsigned long index = 0;
+		_BitScanForward64(&index, mask);
+		return cast(u32)index >> SCOPE_MAP_GROUP_MASK_SHIFT;
+	#else
+		return cast(u32)__builtin_ctzll(mask) >> SCOPE_MAP_GROUP_MASK_SHIFT;
+	#endif
+#elif defined(GB_COMPILER_MSVC)
+	unsigned long index = 0;
+	_BitScanForward(&index, mask);
+	return cast(u32)index;
+#else
+	return cast(u32)__builtin_ctz(mask);
+#endif
+}
+
+gb_internal gb_inline u32 scope_map_max_load(u32 cap) {
+	return cap - (cap>>2); // 75%
+}
+
+gb_internal gb_inline void scope_map_init(ScopeMap *m) {
+	m->cap = SCOPE_MAP_INLINE_CAP;
+	m->slots = m->inline_slots;
+	m->ctrl  = m->inline_ctrl;
+}
+
+// NOTE: The groups are visited with triangular probing, which reaches every group as the group count
+// is a power of two. The map is never completely full, so every probe sequence reaches an empty byte.
+gb_internal void scope_map_insert_for_rehash(
+	ScopeMapSlot *slots, u8 *ctrl, u32 cap,
+	InternedString key, u32 hash, Entity *value) {
+	u32 group_mask = (cap/SCOPE_MAP_GROUP_WIDTH) - 1;
+	u32 group = hash & group_mask;
+	for (u32 step = 1; ; step++) {
+		u32 base = group*SCOPE_MAP_GROUP_WIDTH;
+		ScopeMapGroupMask empty = scope_map_group_match_empty(ctrl + base);
+		if (empty) {
+			u32 pos = base + scope_map_lowest_set_bit(empty);
+			ctrl[pos]        = scope_map_ctrl_tag(hash);
+			slots[pos].hash  = hash;
+			slots[pos].key   = key;
+			slots[pos].value = value;
+			return;
+		}
+		group = (group + step) & group_mask;
+	}
+}
+
+gb_internal gb_inline void scope_map_allocate_entries(u32 cap, ScopeMapSlot **slots, u8 **ctrl) {
+	Arena *arena = get_arena(ThreadArena_Permanent);
+	isize size = (gb_size_of(ScopeMapSlot) + gb_size_of(u8)) * cap;
+	u8 *data = cast(u8 *)arena_alloc(arena, size, 16);
+
+	*slots = cast(ScopeMapSlot *)data;
+	*ctrl  = cast(u8 *)(*slots + cap);
+}
+
+
+gb_internal void scope_map_rehash(ScopeMap *m, u32 new_cap) {
+	GB_ASSERT(new_cap > m->cap);
+	GB_ASSERT(new_cap % SCOPE_MAP_GROUP_WIDTH == 0);
+
+	ScopeMapSlot *new_slots;
+	u8 *          new_ctrl;
+	scope_map_allocate_entries(new_cap, &new_slots, &new_ctrl);
+
+	if (m->count > 0) {
+		for (u32 i = 0; i < m->cap; i++) {
+			if (m->ctrl[i]) {
+				scope_map_insert_for_rehash(new_slots, new_ctrl, new_cap,
+				                            m->slots[i].key, m->slots[i].hash, m->slots[i].value);
+			}
+		}
+	}
+
+	m->slots = new_slots;
+	m->ctrl  = new_ctrl;
+	m->cap   = new_cap;
+}
+
+gb_internal void scope_map_grow(ScopeMap *m) {
+	scope_map_rehash(m, m->cap << 1);
+}
+
+gb_internal void scope_map_reserve(ScopeMap *m, isize capacity) {
+	if (m->slots == nullptr) {
+		scope_map_init(m);
+	}
+	u32 new_cap = next_pow2_u32(cast(u32)capacity);
+	if (m->cap < new_cap && new_cap > SCOPE_MAP_INLINE_CAP) {
+		scope_map_rehash(m, new_cap);
+	}
+}
+
+
+
+gb_internal Entity *scope_map_insert(ScopeMap *m, InternedString key, u32 hash, Entity *value) {
+	if (m->slots == nullptr) {
+		scope_map_init(m);
+	}
+
+	u8 tag = scope_map_ctrl_tag(hash);
+	u32 group_mask = (m->cap/SCOPE_MAP_GROUP_WIDTH) - 1;
+	u32 group = hash & group_mask;
+	for (u32 step = 1; ; step++) {
+		u32 base = group*SCOPE_MAP_GROUP_WIDTH;
+		u8 const *ctrl = m->ctrl + base;
+		for (ScopeMapGroupMask match = scope_map_group_match(ctrl, tag); match != 0; match &= match-1) {
+			u32 pos = base + scope_map_lowest_set_bit(match);
+			if (m->slots[pos].hash == hash && m->slots[pos].key == key) {
+				Entity *old = m->slots[pos].value;
+				m->slots[pos].value = value;
+				return old;
+			}
+		}
+		if (scope_map_group_match_empty(ctrl) != 0) {
+			break;
+		}
+		group = (group + step) & group_mask;
+	}
+
+	if (m->count >= scope_map_max_load(m->cap)) {
+		scope_map_grow(m);
+	}
+	scope_map_insert_for_rehash(m->slots, m->ctrl, m->cap, key, hash, value);
+	m->count += 1;
+	return nullptr;
+}
+
+gb_internal Entity *scope_map_get(ScopeMap *m, InternedString key, u32 hash) {
+	if (m->count == 0) {
+		return nullptr;
+	}
+	u8 tag = scope_map_ctrl_tag(hash);
+	u32 group_mask = (m->cap/SCOPE_MAP_GROUP_WIDTH) - 1;
+	u32 group = hash & group_mask;
+	for (u32 step = 1; ; step++) {
+		u32 base = group*SCOPE_MAP_GROUP_WIDTH;
+		u8 const *ctrl = m->ctrl + base;
+		for (ScopeMapGroupMask match = scope_map_group_match(ctrl, tag); match != 0; match &= match-1) {
+			u32 pos = base + scope_map_lowest_set_bit(match);
+			if (m->slots[pos].hash == hash && m->slots[pos].key == key) {
+				return m->slots[pos].value;
+			}
+		}
+		if (scope_map_group_match_empty(ctrl) != 0) {
+			return nullptr;
+		}
+		group = (group + step) & group_mask;
+	}
+}
+
+gb_internal void scope_map_clear(ScopeMap *m) {
+	gb_memset(m->slots, 0, gb_size_of(*m->slots) * m->cap);
+	gb_memset(m->ctrl,  0, gb_size_of(*m->ctrl)  * m->cap);
+	m->count = 0;
+}
+
+struct ScopeMapIterator {
+	ScopeMap const *map;
+	u32 index;
+
+	ScopeMapIterator &operator++() noexcept {
+		for (;;) {
+			++index;
+			if (map->cap == index) {
+				return *this;
+			}
+			ScopeMapSlot *s = map->slots+index;
+			if (s->hash) {
+				return *this;
+			}
+		}
+	}
+
+	bool operator==(ScopeMapIterator const &other) const noexcept {
+		return this->map == other.map && this->index == other.index;
+	}
+
+	operator ScopeMapSlot *() const {
+		return map->slots+index;
+	}
+};
+
+
+gb_internal ScopeMapIterator end(ScopeMap &m) noexcept {
+	return ScopeMapIterator{&m, m.cap};
+}
+gb_internal ScopeMapIterator const end(ScopeMap const &m) noexcept {
+	return ScopeMapIterator{&m, m.cap};
+}
+gb_internal ScopeMapIterator begin(ScopeMap &m) noexcept {
+	if (m.count == 0) {
+		return end(m);
+	}
+
+	u32 index = 0;
+	while (index < m.cap) {
+		if (m.slots[index].hash) {
+			break;
+		}
+		index++;
+	}
+	return ScopeMapIterator{&m, index};
+}
+gb_internal ScopeMapIterator const begin(ScopeMap const &m) noexcept {
+	if (m.count == 0) {
+		return end(m);
+	}
+
+	u32 index = 0;
+	while (index < m.cap) {
+		if (m.slots[index].hash) {
+			break;
+		}
+		index++;
+	}
+	return ScopeMapIterator{&m, index};
+}
@@ -4,6 +4,12 @@
 #define STRING_INTERNER_THREAD_LOCAL_SIZE (1024 * 1024 * 2)
 #define STRING_INTERN_CACHE_LINE (2*GB_CACHE_LINE_SIZE)
 
+// NOTE: The table starts small and doubles whenever an insertion has to walk a chain longer than
+// STRING_INTERNER_MAX_CHAIN_LENGTH cells, up to STRING_INTERNER_MAX_CELL_COUNT cells
+#define STRING_INTERNER_INITIAL_CELL_COUNT (1llu << 14llu)
+#define STRING_INTERNER_MAX_CELL_COUNT     (1llu << 20llu)
+#define STRING_INTERNER_MAX_CHAIN_LENGTH   2
+
 struct InternedString {
 	u32 value;
 	bool operator==(InternedString other) const {
@@ -26,18 +32,26 @@ struct alignas(STRING_INTERN_CACHE_LINE) PaddedMutex {
 	BlockingMutex m;
 };
 
-struct alignas(STRING_INTERN_CACHE_LINE) PaddedI64 {
-	std::atomic<i64> value;
+// NOTE: The counters are only written while `m` is held
+struct alignas(STRING_INTERN_CACHE_LINE) StringInternStripe {
+	BlockingMutex m;
+	i64           count;
+	i64           acquisitions;
+	i64           contended;
 };
 
-struct StringInterner {
+struct StringInternTable {
 	StringInternCell *cells;
-	u64          cell_mask;
-	PaddedMutex  mutexes[STRING_INTERNER_MUTEX_STRIPE_COUNT];
-	StaticArena  arena;
-	PaddedMutex  arena_mutex;
-	bool         track_count;
-	PaddedI64    count;
+	u64               cell_mask;
+};
+
+struct StringInterner {
+	std::atomic<StringInternTable *> table;
+	StringInternStripe mutexes[STRING_INTERNER_MUTEX_STRIPE_COUNT];
+	StaticArena        arena;
+	PaddedMutex        arena_mutex;
+	PaddedMutex        grow_mutex;
+	i32                grow_count;
 };
 
 gb_internal StringInterner *string_interner_create();
@@ -56,17 +70,21 @@ gb_thread_local gb_global StringInternerThreadLocalArena g_interner_arena;
 gb_internal void  string_interner_thread_local_arena_init(StringInternerThreadLocalArena *tl_arena);
 gb_internal void *string_interner_thread_local_arena_alloc(StringInternerThreadLocalArena *tl_arena, isize size, isize alignment);
 
+gb_internal StringInternTable *string_interner_alloc_table(StringInterner *interner, u64 cell_count) {
+	MUTEX_GUARD(&interner->arena_mutex.m);
+	StringInternTable *table = cast(StringInternTable *)static_arena_alloc(&interner->arena, gb_size_of(StringInternTable), 8);
+	table->cell_mask = cell_count - 1;
+	table->cells = cast(StringInternCell *)static_arena_alloc(&interner->arena, cell_count * gb_size_of(StringInternCell), STRING_INTERN_CACHE_LINE);
+	return table;
+}
+
 gb_internal void init_string_interner() {
 	StaticArena arena = {};
 	static_arena_init(&arena, 1<<30, STATIC_ARENA_DEFAULT_COMMIT_BLOCK_SIZE);
 
 	StringInterner *interner = cast(StringInterner *)static_arena_alloc(&arena, gb_size_of(StringInterner), STRING_INTERN_CACHE_LINE);
 	interner->arena = arena;
-	u64 cell_size = 1llu << 17llu;
-	u64 cell_mask = cell_size - 1;
-	interner->cell_mask = cell_mask;
-	interner->cells = cast(StringInternCell *)static_arena_alloc(&interner->arena, cell_size * gb_size_of(StringInternCell), STRING_INTERN_CACHE_LINE);
-	interner->track_count = false;
+	interner->table.store(string_interner_alloc_table(interner, STRING_INTERNER_INITIAL_CELL_COUNT), std::memory_order_relaxed);
 
 	g_string_interner = interner;
 
@@ -110,54 +128,121 @@ bool InternedString::is_blank() const {
 	return this->value == g_interned_blank_ident.value;
 }
 
-gb_internal InternedString string_interner_insert(String str, u32 hash, u32 *new_hash_) {
-	StringInterner* interner = g_string_interner;
-	if (str.len == 0) {
-		if (new_hash_) *new_hash_ = string_hash(String{});
-		return {};
-	}
-
-	if (hash == 0) {
-		hash = string_hash(str);
-	}
-	if (new_hash_) *new_hash_ = hash;
-
-	u64 cell_idx = hash & interner->cell_mask;
-	StringInternCell *cell = &interner->cells[cell_idx];
-	while (true) {
-		StringInternCell *next = cell->next.load(std::memory_order_acquire);
-
+// NOTE: Appends an entry to the end of the chain of `cell`, returning the number of cells walked.
+// The caller must either hold the stripe mutex of the bucket or have exclusive access to the table.
+gb_internal isize string_interner_append_to_chain(StringInternCell *cell, u64 hash, InternedString offset) {
+	isize chain_length = 1;
+	for (;;) {
 		for (i32 i = 0; i < STRING_INTERNER_CELL_WIDTH; i += 1) {
-			if (cell->hashes[i].load(std::memory_order_acquire) == hash) {
-				String to_compare = string_interner_load(cell->offsets[i]);
-				if (to_compare == str) {
-					return cell->offsets[i];
-				}
+			if (cell->hashes[i].load(std::memory_order_relaxed) == 0) {
+				cell->offsets[i] = offset;
+				cell->hashes[i].store(hash, std::memory_order_release);
+				return chain_length;
 			}
 		}
+		StringInternCell *next = cell->next.load(std::memory_order_relaxed);
 		if (next == nullptr) {
 			break;
 		}
 		cell = next;
+		chain_length += 1;
 	}
 
-	u64 mutex_cell = cell_idx & STRING_INTERNER_MUTEX_STRIPE_MASK;
-	PaddedMutex* m = &interner->mutexes[mutex_cell];
-	MUTEX_GUARD(&m->m);
+	StringInternCell *new_cell = cast(StringInternCell *)string_interner_thread_local_arena_alloc(&g_interner_arena, gb_size_of(StringInternCell), STRING_INTERN_CACHE_LINE);
+	new_cell->offsets[0] = offset;
+	new_cell->hashes[0].store(hash, std::memory_order_relaxed);
+	cell->next.store(new_cell, std::memory_order_release);
+	return chain_length + 1;
+}
 
-	StringInternCell *load_cell = nullptr;
-	while (cell) {
+gb_internal InternedString string_interner_find_in_chain(StringInternCell *cell, u64 hash, String const &str) {
+	while (cell != nullptr) {
 		for (i32 i = 0; i < STRING_INTERNER_CELL_WIDTH; i += 1) {
-			if (cell->hashes[i].load(std::memory_order_relaxed) == hash) {
-				// string check
+			if (cell->hashes[i].load(std::memory_order_acquire) == hash) {
 				String to_compare = string_interner_load(cell->offsets[i]);
 				if (to_compare == str) {
 					return cell->offsets[i];
 				}
 			}
 		}
-		load_cell = cell;
-		cell = cell->next.load(std::memory_order_relaxed);
+		cell = cell->next.load(std::memory_order_acquire);
+	}
+	return {};
+}
+
+// NOTE: Doubles the table. Readers are never blocked: they keep using whichever table they loaded,
+// and every table stays valid since nothing is ever removed. Writers are held off by taking every
+// stripe mutex, which is fine as this only happens a handful of times per compilation.
+gb_internal void string_interner_grow(StringInterner *interner, StringInternTable *expected) {
+	MUTEX_GUARD(&interner->grow_mutex.m);
+	StringInternTable *old_table = interner->table.load(std::memory_order_acquire);
+	if (old_table != expected) {
+		// another thread has already grown it
+		return;
+	}
+	u64 old_cell_count = old_table->cell_mask + 1;
+	if (old_cell_count >= STRING_INTERNER_MAX_CELL_COUNT) {
+		return;
+	}
+
+	for (isize i = 0; i < STRING_INTERNER_MUTEX_STRIPE_COUNT; i++) {
+		mutex_lock(&interner->mutexes[i].m);
+	}
+
+	StringInternTable *new_table = string_interner_alloc_table(interner, old_cell_count*2);
+	for (u64 cell_idx = 0; cell_idx < old_cell_count; cell_idx++) {
+		for (StringInternCell *cell = &old_table->cells[cell_idx]; cell != nullptr; cell = cell->next.load(std::memory_order_relaxed)) {
+			for (i32 i = 0; i < STRING_INTERNER_CELL_WIDTH; i += 1) {
+				u64 hash = cell->hashes[i].load(std::memory_order_relaxed);
+				if (hash != 0) {
+					StringInternCell *dst = &new_table->cells[hash & new_table->cell_mask];
+					string_interner_append_to_chain(dst, hash, cell->offsets[i]);
+				}
+			}
+		}
+	}
+	interner->table.store(new_table, std::memory_order_release);
+	interner->grow_count += 1;
+
+	for (isize i = STRING_INTERNER_MUTEX_STRIPE_COUNT-1; i >= 0; i--) {
+		mutex_unlock(&interner->mutexes[i].m);
+	}
+}
+
+gb_internal InternedString string_interner_insert(String str, u32 hash, u32 *new_hash_) {
+	StringInterner* interner = g_string_interner;
+	if (str.len == 0) {
+		if (new_hash_) *new_hash_ = string_hash(String{});
+		return {};
+	}
+
+	if (hash == 0) {
+		hash = string_hash(str);
+	}
+	if (new_hash_) *new_hash_ = hash;
+
+	StringInternTable *table = interner->table.load(std::memory_order_acquire);
+	InternedString found = string_interner_find_in_chain(&table->cells[hash & table->cell_mask], hash, str);
+	if (found.value != 0) {
+		return found;
+	}
+
+	// NOTE: The stripe only depends on the hash so that it stays the same across table sizes
+	StringInternStripe *stripe = &interner->mutexes[hash & STRING_INTERNER_MUTEX_STRIPE_MASK];
+	bool contended = !mutex_try_lock(&stripe->m);
+	if (contended) {
+		mutex_lock(&stripe->m);
+	}
+	stripe->acquisitions += 1;
+	stripe->contended += contended;
+
+	// NOTE: The table cannot be grown while any stripe is held, but it may have been grown since the load above
+	table = interner->table.load(std::memory_order_acquire);
+	StringInternCell *cell = &table->cells[hash & table->cell_mask];
+	found = string_interner_find_in_chain(cell, hash, str);
+	if (found.value != 0) {
+		mutex_unlock(&stripe->m);
+		return found;
 	}
 
 	u64 data_to_allocate = 4 + str.len + 1;
@@ -168,27 +253,54 @@ gb_internal InternedString string_interner_insert(String str, u32 hash, u32 *new
 	data[4+str_len] = 0;
 	InternedString offset = { cast(u32)(cast(u8 *)data - cast(u8 *)interner) };
 
-	for (i32 i = 0; i < STRING_INTERNER_CELL_WIDTH; i += 1) {
-		if (load_cell->hashes[i].load(std::memory_order_relaxed) == 0) {
-			load_cell->offsets[i] = offset;
-			load_cell->hashes[i].store(hash, std::memory_order_release);
-			if (interner->track_count) {
-				interner->count.value.fetch_add(1, std::memory_order_relaxed);
-			}
-			return offset;
-		}
+	isize chain_length = string_interner_append_to_chain(cell, hash, offset);
+	stripe->count += 1;
+	mutex_unlock(&stripe->m);
+
+	if (chain_length > STRING_INTERNER_MAX_CHAIN_LENGTH) {
+		string_interner_grow(interner, table);
 	}
 
-	StringInternCell *new_cell = cast(StringInternCell *)string_interner_thread_local_arena_alloc(&g_interner_arena, gb_size_of(StringInternCell), STRING_INTERN_CACHE_LINE);
-	new_cell->offsets[0] = offset;
-	new_cell->hashes[0].store(hash, std::memory_order_relaxed);
-	load_cell->next.store(new_cell, std::memory_order_release);
+	return offset;
+}
 
-	if (interner->track_count) {
-		interner->count.value.fetch_add(1, std::memory_order_relaxed);
+gb_internal void string_interner_print_stats() {
+	StringInterner *interner = g_string_interner;
+	StringInternTable *table = interner->table.load(std::memory_order_acquire);
+
+	i64 count = 0;
+	i64 acquisitions = 0;
+	i64 contended = 0;
+	for (isize i = 0; i < STRING_INTERNER_MUTEX_STRIPE_COUNT; i++) {
+		StringInternStripe *stripe = &interner->mutexes[i];
+		MUTEX_GUARD(&stripe->m);
+		count        += stripe->count;
+		acquisitions += stripe->acquisitions;
+		contended    += stripe->contended;
 	}
 
-	return offset;
+	u64 cell_count = table->cell_mask + 1;
+	isize max_chain_length = 0;
+	i64 overflow_cells = 0;
+	for (u64 cell_idx = 0; cell_idx < cell_count; cell_idx++) {
+		isize chain_length = 0;
+		for (StringInternCell *cell = &table->cells[cell_idx]; cell != nullptr; cell = cell->next.load(std::memory_order_acquire)) {
+			chain_length += 1;
+		}
+		max_chain_length = gb_max(max_chain_length, chain_length);
+		overflow_cells += chain_length-1;
+	}
+
+	f64 slots = cast(f64)(cell_count*STRING_INTERNER_CELL_WIDTH);
+	gb_printf("String interner:\n");
+	gb_printf("  strings          %lld\n", cast(long long)count);
+	gb_printf("  cells            %llu (%d grows)\n", cast(unsigned long long)cell_count, interner->grow_count);
+	gb_printf("  load factor      %.3f\n", cast(f64)count/slots);
+	gb_printf("  max chain length %td\n", max_chain_length);
+	gb_printf("  overflow cells   %lld\n", cast(long long)overflow_cells);
+	gb_printf("  mutex contention %lld / %lld (%.2f%%)\n",
+	          cast(long long)contended, cast(long long)acquisitions,
+	          acquisitions ? 100.0*cast(f64)contended/cast(f64)acquisitions : 0.0);
 }
 
 gb_internal char const *string_intern_cstring(String str, u32 *hash_=nullptr) {
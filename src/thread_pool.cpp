@@ -64,6 +64,21 @@ gb_internal void thread_pool_init(ThreadPool *pool, isize worker_count, char con
 	}
 }
 
+// NOTE: Frees the arena of the given kind of every thread within the pool. This must only be called
+// from the main thread while no tasks are running, and nothing allocated from those arenas may be
+// referenced afterwards.
+gb_internal void thread_pool_free_arenas(ThreadPool *pool, ThreadArenaKind kind) {
+	GB_ASSERT(get_current_thread() == &pool->threads[0]);
+	for (Thread &t : pool->threads) {
+		Arena *arena = get_thread_arena(&t, kind);
+		GB_ASSERT(arena->temp_count == 0);
+		arena_free_all(arena);
+	}
+	Arena *arena = get_thread_arena(nullptr, kind);
+	GB_ASSERT(arena->temp_count == 0);
+	arena_free_all(arena);
+}
+
 gb_internal void thread_pool_destroy(ThreadPool *pool) {
 	pool->running.store(false, std::memory_order_seq_cst);
 
@@ -73,6 +73,7 @@ struct Thread {
 
 	struct Arena *permanent_arena;
 	struct Arena *temporary_arena;
+	struct Arena *checking_arena;
 };
 
 typedef std::atomic<i32> Futex;
@@ -1,7 +1,8 @@
 struct TimeStamp {
-	u64    start;
-	u64    finish;
-	String label;
+	u64         start;
+	u64         finish;
+	String      label;
+	MemoryUsage memory; // at `finish`, only when `Timings.track_memory` is set
 };
 
 struct Timings {
@@ -9,6 +10,7 @@ struct Timings {
 	Array<TimeStamp> sections;
 	u64              freq;
 	f64              total_time_seconds;
+	bool             track_memory;
 };
 
 
@@ -124,7 +126,11 @@ gb_internal void timings_destroy(Timings *t) {
 
 gb_internal void timings__stop_current_section(Timings *t) {
 	if (t->sections.count > 0) {
-		t->sections[t->sections.count-1].finish = time_stamp_time_now();
+		TimeStamp *ts = &t->sections[t->sections.count-1];
+		ts->finish = time_stamp_time_now();
+		if (t->track_memory) {
+			memory_usage_snapshot(&ts->memory);
+		}
 	}
 }
 
@@ -171,6 +177,38 @@ gb_internal f64 time_stamp(TimeStamp const &ts, u64 freq, TimingUnit unit) {
 	}
 }
 
+gb_internal void timings__print_memory_column(i64 bytes) {
+	if (bytes < 0) {
+		gb_printf_err(" %10s", "-");
+	} else {
+		gb_printf_err(" %10.1f", cast(f64)bytes / cast(f64)(1024ull * 1024ull));
+	}
+}
+
+// NOTE: Prints the memory usage at the end of each section: the process peak and current resident set
+// size followed by the bytes handed out by each kind of arena and allocator
+gb_internal void timings_print_memory_usage(Timings *t, isize max_len, char const *spaces) {
+	String title = str_lit("Memory (MiB)");
+	max_len = gb_max(max_len, title.len);
+
+	gb_printf_err("\n");
+	gb_printf_err("%.*s%.*s - %10s %10s", LIT(title), cast(int)(max_len-title.len), spaces, "peak RSS", "RSS");
+	for (isize kind = 0; kind < MemoryUsage_COUNT; kind++) {
+		gb_printf_err(" %10s", memory_usage_kind_strings[kind]);
+	}
+	gb_printf_err("\n");
+
+	for (TimeStamp const &ts : t->sections) {
+		gb_printf_err("%.*s%.*s -", LIT(ts.label), cast(int)(max_len-ts.label.len), spaces);
+		timings__print_memory_column(ts.memory.peak_rss);
+		timings__print_memory_column(ts.memory.current_rss);
+		for (isize kind = 0; kind < MemoryUsage_COUNT; kind++) {
+			timings__print_memory_column(ts.memory.bytes[kind]);
+		}
+		gb_printf_err("\n");
+	}
+}
+
 gb_internal void timings_print_all(Timings *t, TimingUnit unit = TimingUnit_Millisecond, bool timings_are_finalized = false) {
 	isize const SPACES_LEN = 256;
 	char SPACES[SPACES_LEN+1] = {0};
@@ -214,4 +252,8 @@ gb_internal void timings_print_all(Timings *t, TimingUnit unit = TimingUnit_Mill
 		          timing_unit_strings[unit],
 		          100.0*section_time/total_time);
 	}
+
+	if (t->track_memory) {
+		timings_print_memory_usage(t, max_len, SPACES);
+	}
 }
\ No newline at end of file
@@ -1033,22 +1033,97 @@ gb_internal Type *alloc_type_generic(Scope *scope, i64 id, InternedString intern
 	return t;
 }
 
-gb_internal Type *alloc_type_pointer(Type *elem) {
-	Type *t = alloc_type(Type_Pointer);
-	t->Pointer.elem = elem;
+// NOTE: Composite types which are fully determined by their constructor arguments and never modified
+// afterwards are hash-consed, so that e.g. every `^T` shares one `Type` and most identity checks become
+// a pointer compare in `are_types_identical`. The key uses the element pointer, so it is exact whenever
+// the element types are themselves shared, and otherwise falls back to the structural comparison.
+// Types which are filled in or specialized in place after construction (tuples, procedures, records,
+// `[?]T` and polymorphic counts) are still allocated individually.
+#define TYPE_INTERN_BUCKET_COUNT       (1<<16)
+#define TYPE_INTERN_MUTEX_STRIPE_COUNT 256
+
+struct TypeInternKey {
+	TypeKind kind;
+	Type *   elem;
+	i64      count;
+};
+
+struct TypeInternEntry {
+	TypeInternKey     key;
+	Type *            type;
+	TypeInternEntry * next;
+};
+
+gb_global std::atomic<TypeInternEntry *> g_type_intern_buckets[TYPE_INTERN_BUCKET_COUNT];
+gb_global BlockingMutex                  g_type_intern_mutexes[TYPE_INTERN_MUTEX_STRIPE_COUNT];
+
+gb_internal gb_inline bool type_intern_key_equal(TypeInternKey const &a, TypeInternKey const &b) {
+	return a.kind == b.kind && a.elem == b.elem && a.count == b.count;
+}
+
+gb_internal Type *alloc_type_interned(TypeKind kind, Type *elem, i64 count=0) {
+	TypeInternKey key = {};
+	key.kind  = kind;
+	key.elem  = elem;
+	key.count = count;
+
+	// NOTE: the fields are hashed one by one, as the padding after `kind` is not guaranteed to be zero
+	u64 hash = fnv64a(&key.kind, gb_size_of(key.kind));
+	hash = fnv64a(&key.elem,  gb_size_of(key.elem),  hash);
+	hash = fnv64a(&key.count, gb_size_of(key.count), hash);
+	u64 index = hash & (TYPE_INTERN_BUCKET_COUNT-1);
+	std::atomic<TypeInternEntry *> *bucket = &g_type_intern_buckets[index];
+
+	// NOTE: entries are immutable once published, so the common case of an existing type is lock-free
+	for (TypeInternEntry *e = bucket->load(std::memory_order_acquire); e != nullptr; e = e->next) {
+		if (type_intern_key_equal(e->key, key)) {
+			return e->type;
+		}
+	}
+
+	MUTEX_GUARD(&g_type_intern_mutexes[index & (TYPE_INTERN_MUTEX_STRIPE_COUNT-1)]);
+
+	TypeInternEntry *head = bucket->load(std::memory_order_relaxed);
+	for (TypeInternEntry *e = head; e != nullptr; e = e->next) {
+		if (type_intern_key_equal(e->key, key)) {
+			return e->type;
+		}
+	}
+
+	Type *t = alloc_type(kind);
+	switch (kind) {
+	case Type_Pointer:      t->Pointer.elem      = elem; break;
+	case Type_MultiPointer: t->MultiPointer.elem = elem; break;
+	case Type_SoaPointer:   t->SoaPointer.elem   = elem; break;
+	case Type_Slice:        t->Slice.elem        = elem; break;
+	case Type_DynamicArray: t->DynamicArray.elem = elem; break;
+	case Type_Array:
+		t->Array.elem  = elem;
+		t->Array.count = count;
+		break;
+	default:
+		GB_PANIC("Unsupported interned type kind: %.*s", LIT(type_strings[kind]));
+		break;
+	}
+
+	TypeInternEntry *entry = permanent_alloc_item<TypeInternEntry>();
+	entry->key  = key;
+	entry->type = t;
+	entry->next = head;
+	bucket->store(entry, std::memory_order_release);
 	return t;
 }
 
+gb_internal Type *alloc_type_pointer(Type *elem) {
+	return alloc_type_interned(Type_Pointer, elem);
+}
+
 gb_internal Type *alloc_type_multi_pointer(Type *elem) {
-	Type *t = alloc_type(Type_MultiPointer);
-	t->MultiPointer.elem = elem;
-	return t;
+	return alloc_type_interned(Type_MultiPointer, elem);
 }
 
 gb_internal Type *alloc_type_soa_pointer(Type *elem) {
-	Type *t = alloc_type(Type_SoaPointer);
-	t->SoaPointer.elem = elem;
-	return t;
+	return alloc_type_interned(Type_SoaPointer, elem);
 }
 
 gb_internal Type *alloc_type_pointer_to_multi_pointer(Type *ptr) {
@@ -1081,10 +1156,14 @@ gb_internal Type *alloc_type_array(Type *elem, i64 count, Type *generic_count =
 		t->Array.generic_count = generic_count;
 		return t;
 	}
-	Type *t = alloc_type(Type_Array);
-	t->Array.elem = elem;
-	t->Array.count = count;
-	return t;
+	if (count < 0) {
+		// NOTE: `[?]T` has its count filled in once the compound literal has been checked
+		Type *t = alloc_type(Type_Array);
+		t->Array.elem = elem;
+		t->Array.count = count;
+		return t;
+	}
+	return alloc_type_interned(Type_Array, elem, count);
 }
 
 gb_internal Type *alloc_type_matrix(Type *elem, i64 row_count, i64 column_count, Type *generic_row_count, Type *generic_column_count, bool is_row_major) {
@@ -1127,15 +1206,11 @@ gb_internal Type *alloc_type_enumerated_array(Type *elem, Type *index, ExactValu
 
 
 gb_internal Type *alloc_type_slice(Type *elem) {
-	Type *t = alloc_type(Type_Slice);
-	t->Slice.elem = elem;
-	return t;
+	return alloc_type_interned(Type_Slice, elem);
 }
 
 gb_internal Type *alloc_type_dynamic_array(Type *elem) {
-	Type *t = alloc_type(Type_DynamicArray);
-	t->DynamicArray.elem = elem;
-	return t;
+	return alloc_type_interned(Type_DynamicArray, elem);
 }
 
 gb_internal Type *alloc_type_fixed_capacity_dynamic_array(Type *elem, i64 capacity, Type *generic_capacity = nullptr) {
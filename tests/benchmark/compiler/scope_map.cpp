@@ -0,0 +1,188 @@
+// Correctness check and micro-benchmark for the compiler's ScopeMap (src/scope_map.hpp), compared against
+// the Robin Hood map it replaced: insert, hit and miss lookups at 1k, 10k and 100k entries.
+// Build and run from the repository root with:
+//
+//     clang++ -std=c++14 -O2 -pthread -Dgb_inline=inline -Isrc tests/benchmark/compiler/scope_map.cpp -o scope_map_bench
+//     ./scope_map_bench          # checks, then benchmarks
+//     ./scope_map_bench -check   # checks only
+//
+// Add -DSCOPE_MAP_NO_SIMD to use the portable SWAR group match instead of SSE2, or -DSCOPE_MAP_ENABLE_NEON
+// to use the NEON group match on arm64. Any failed check is a GB_ASSERT.
+
+#include "common.cpp"
+#include "timings.cpp"
+
+// NOTE: common.cpp only declares these, they live in error.cpp with the rest of the front-end
+gb_internal bool any_errors(void)   { return false; }
+gb_internal bool any_warnings(void) { return false; }
+gb_internal void print_all_errors(void) {}
+
+struct Entity { int unused; };
+
+#include "scope_map.hpp"
+
+namespace robin_hood {
+#include "scope_map_robin_hood.hpp"
+}
+
+struct ScopeMapBenchKeys {
+	Array<InternedString> keys;
+	Array<u32>            hashes;
+	Array<InternedString> miss_keys;
+	Array<u32>            miss_hashes;
+};
+
+gb_internal ScopeMapBenchKeys scope_map_bench_keys(int n) {
+	ScopeMapBenchKeys k = {};
+	array_init(&k.keys,        heap_allocator(), 0, n);
+	array_init(&k.hashes,      heap_allocator(), 0, n);
+	array_init(&k.miss_keys,   heap_allocator(), 0, n);
+	array_init(&k.miss_hashes, heap_allocator(), 0, n);
+
+	char buf[64];
+	for (int i = 0; i < n; i++) {
+		u32 hash = 0;
+		int len = cast(int)gb_snprintf(buf, gb_size_of(buf), "gl_Bindings_Symbol_%d", i) - 1;
+		array_add(&k.keys, string_interner_insert(make_string(cast(u8 *)buf, len), 0, &hash));
+		array_add(&k.hashes, hash);
+
+		len = cast(int)gb_snprintf(buf, gb_size_of(buf), "missing_%d", i) - 1;
+		array_add(&k.miss_keys, string_interner_insert(make_string(cast(u8 *)buf, len), 0, &hash));
+		array_add(&k.miss_hashes, hash);
+	}
+	return k;
+}
+
+gb_internal void scope_map_bench_keys_free(ScopeMapBenchKeys *k) {
+	array_free(&k->keys);
+	array_free(&k->hashes);
+	array_free(&k->miss_keys);
+	array_free(&k->miss_hashes);
+}
+
+// NOTE: the scope_map_* calls resolve through argument dependent lookup, so `Map` may be either map
+template <typename Map>
+gb_internal void scope_map_check(ScopeMapBenchKeys const &k, Entity *entities) {
+	isize n = k.keys.count;
+
+	Map m = {};
+	for (isize i = 0; i < n; i++) {
+		GB_ASSERT(scope_map_insert(&m, k.keys[i], k.hashes[i], &entities[i]) == nullptr);
+	}
+	GB_ASSERT(m.count == cast(u32)n);
+
+	// Inserting an existing key replaces its value and returns the old one
+	for (isize i = 0; i < n; i += 7) {
+		GB_ASSERT(scope_map_insert(&m, k.keys[i], k.hashes[i], &entities[n+i]) == &entities[i]);
+	}
+	GB_ASSERT(m.count == cast(u32)n);
+
+	for (isize i = 0; i < n; i++) {
+		Entity *expected = (i % 7 == 0) ? &entities[n+i] : &entities[i];
+		GB_ASSERT(scope_map_get(&m, k.keys[i], k.hashes[i]) == expected);
+		GB_ASSERT(scope_map_get(&m, k.miss_keys[i], k.miss_hashes[i]) == nullptr);
+	}
+
+	// Iteration visits every entry exactly once
+	isize visited = 0;
+	uintptr value_sum = 0;
+	uintptr expected_sum = 0;
+	for (auto const &entry : m) {
+		visited += 1;
+		value_sum += cast(uintptr)entry.value;
+	}
+	for (isize i = 0; i < n; i++) {
+		expected_sum += cast(uintptr)((i % 7 == 0) ? &entities[n+i] : &entities[i]);
+	}
+	GB_ASSERT(visited == n);
+	GB_ASSERT(value_sum == expected_sum);
+
+	// A reserved map must not need to grow
+	Map r = {};
+	scope_map_reserve(&r, 2*n);
+	u32 reserved_cap = r.cap;
+	for (isize i = 0; i < n; i++) {
+		scope_map_insert(&r, k.keys[i], k.hashes[i], &entities[i]);
+	}
+	GB_ASSERT(r.cap == reserved_cap);
+	for (isize i = 0; i < n; i++) {
+		GB_ASSERT(scope_map_get(&r, k.keys[i], k.hashes[i]) == &entities[i]);
+	}
+}
+
+gb_internal f64 bench_now(void) {
+	return cast(f64)time_stamp_time_now() / cast(f64)time_stamp__freq();
+}
+
+template <typename Map>
+gb_internal void scope_map_bench(char const *name, ScopeMapBenchKeys const &k) {
+	isize n = k.keys.count;
+	static Entity e = {};
+	isize reps = gb_max(1, 2000000/n);
+	Map *maps = gb_alloc_array(heap_allocator(), Map, reps);
+	defer (gb_free(heap_allocator(), maps));
+
+	f64 t0 = bench_now();
+	for (isize r = 0; r < reps; r++) {
+		for (isize i = 0; i < n; i++) {
+			scope_map_insert(&maps[r], k.keys[i], k.hashes[i], &e);
+		}
+	}
+
+	f64 t1 = bench_now();
+	isize lookups = 0;
+	isize found = 0;
+	for (isize r = 0; r < reps; r += gb_max(1, reps/10)) {
+		for (isize i = 0; i < n; i++) {
+			found += scope_map_get(&maps[r], k.keys[i], k.hashes[i]) != nullptr;
+		}
+		lookups += n;
+	}
+
+	f64 t2 = bench_now();
+	isize missed = 0;
+	for (isize r = 0; r < reps; r += gb_max(1, reps/10)) {
+		for (isize i = 0; i < n; i++) {
+			missed += scope_map_get(&maps[r], k.miss_keys[i], k.miss_hashes[i]) == nullptr;
+		}
+	}
+	f64 t3 = bench_now();
+
+	GB_ASSERT(found == lookups);
+	GB_ASSERT(missed == lookups);
+
+	gb_printf("%s\tn=%td\tinsert %6.1f ns/op  hit %6.1f ns/op  miss %6.1f ns/op\n", name, n,
+	          1e9*(t1-t0)/(cast(f64)reps*n), 1e9*(t2-t1)/lookups, 1e9*(t3-t2)/lookups);
+}
+
+int main(int argc, char **argv) {
+	virtual_memory_init();
+	init_string_interner();
+
+	bool check_only = argc > 1 && gb_strcmp(argv[1], "-check") == 0;
+
+#if defined(SCOPE_MAP_USE_SSE2)
+	gb_printf("ScopeMap group match: SSE2\n");
+#elif defined(SCOPE_MAP_USE_NEON)
+	gb_printf("ScopeMap group match: NEON\n");
+#else
+	gb_printf("ScopeMap group match: SWAR\n");
+#endif
+
+	int const sizes[] = {1, 15, 16, 17, 1000, 10000, 100000};
+	for (int n : sizes) {
+		ScopeMapBenchKeys k = scope_map_bench_keys(n);
+		Entity *entities = gb_alloc_array(heap_allocator(), Entity, 2*n);
+		scope_map_check<ScopeMap>(k, entities);
+		scope_map_check<robin_hood::ScopeMap>(k, entities);
+		gb_free(heap_allocator(), entities);
+
+		if (!check_only && n >= 1000) {
+			scope_map_bench<robin_hood::ScopeMap>("robin", k);
+			scope_map_bench<ScopeMap>("swiss", k);
+		}
+		scope_map_bench_keys_free(&k);
+	}
+	gb_printf("ScopeMap checks passed\n");
+	return 0;
+}
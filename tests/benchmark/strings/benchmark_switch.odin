@@ -0,0 +1,133 @@
+package benchmark_strings
+
+import "core:fmt"
+import "core:log"
+import "core:testing"
+import "core:strings"
+import "core:text/table"
+import "core:time"
+
+SWITCH_RUNS :: 200_000
+
+switch_keywords := [?]string{
+	"import", "foreign", "package", "typeid", "when", "where", "if", "else", "for", "switch",
+	"in", "not_in", "do", "case", "break", "continue", "fallthrough", "defer", "return", "proc",
+	"struct", "union", "enum", "bit_set", "bit_field", "map", "dynamic", "auto_cast", "cast", "transmute",
+	"distinct", "using", "context", "or_else", "or_return", "or_break", "or_continue", "asm", "matrix",
+}
+
+// The comparison chain which `switch` on a `string` used to be lowered to.
+keyword_index_chain :: proc(s: string) -> int {
+	for kw, i in switch_keywords {
+		if s == kw {
+			return i
+		}
+	}
+	return -1
+}
+
+keyword_index_switch :: proc(s: string) -> int {
+	switch s {
+	case "import":      return 0
+	case "foreign":     return 1
+	case "package":     return 2
+	case "typeid":      return 3
+	case "when":        return 4
+	case "where":       return 5
+	case "if":          return 6
+	case "else":        return 7
+	case "for":         return 8
+	case "switch":      return 9
+	case "in":          return 10
+	case "not_in":      return 11
+	case "do":          return 12
+	case "case":        return 13
+	case "break":       return 14
+	case "continue":    return 15
+	case "fallthrough": return 16
+	case "defer":       return 17
+	case "return":      return 18
+	case "proc":        return 19
+	case "struct":      return 20
+	case "union":       return 21
+	case "enum":        return 22
+	case "bit_set":     return 23
+	case "bit_field":   return 24
+	case "map":         return 25
+	case "dynamic":     return 26
+	case "auto_cast":   return 27
+	case "cast":        return 28
+	case "transmute":   return 29
+	case "distinct":    return 30
+	case "using":       return 31
+	case "context":     return 32
+	case "or_else":     return 33
+	case "or_return":   return 34
+	case "or_break":    return 35
+	case "or_continue": return 36
+	case "asm":         return 37
+	case "matrix":      return 38
+	}
+	return -1
+}
+
+run_trial_switch :: proc(p: proc(string) -> int, inputs: []string, runs: int) -> (timing: time.Duration) {
+	accumulator: int
+
+	watch: time.Stopwatch
+
+	time.stopwatch_start(&watch)
+	for i in 0..<runs {
+		accumulator += p(inputs[i % len(inputs)])
+	}
+	time.stopwatch_stop(&watch)
+	timing = time.stopwatch_duration(watch)
+
+	log.debug(accumulator)
+	return
+}
+
+@test
+benchmark_string_switch :: proc(t: ^testing.T) {
+	hits   := switch_keywords[:]
+	misses := []string{"identifier", "x", "foo", "importer", "whe", "bit_sets", "matrixx", "Switch", "or_els", "procedure"}
+
+	for kw, i in switch_keywords {
+		testing.expect_value(t, keyword_index_switch(kw), i)
+	}
+	for s in misses {
+		testing.expect_value(t, keyword_index_switch(s), -1)
+	}
+
+	string_buffer := strings.builder_make()
+	defer strings.builder_destroy(&string_buffer)
+
+	tbl: table.Table
+	table.init(&tbl)
+	defer table.destroy(&tbl)
+
+	table.aligned_header_of_values(&tbl, .Right, "Inputs", "Iterations", "Chain", "Switch", "Switch Relative (%)", "Switch Relative (x)")
+
+	Trial :: struct {
+		name:   string,
+		inputs: []string,
+	}
+	for trial in ([]Trial{{"hits", hits}, {"misses", misses}}) {
+		chain_timing  := run_trial_switch(keyword_index_chain,  trial.inputs, SWITCH_RUNS)
+		switch_timing := run_trial_switch(keyword_index_switch, trial.inputs, SWITCH_RUNS)
+
+		_chain  := fmt.tprintf("%8M", chain_timing)
+		_switch := fmt.tprintf("%8M", switch_timing)
+		_relp   := fmt.tprintf("%.3f %%", f64(switch_timing) / f64(chain_timing) * 100.0)
+		_relx   := fmt.tprintf("%.3f x",  1 / (f64(switch_timing) / f64(chain_timing)))
+
+		table.aligned_row_of_values(&tbl, .Right, trial.name, SWITCH_RUNS, _chain, _switch, _relp, _relx)
+	}
+
+	builder_writer := strings.to_writer(&string_buffer)
+
+	fmt.sbprintln(&string_buffer)
+	table.write_plain_table(builder_writer, &tbl)
+
+	log.info(strings.to_string(string_buffer))
+}
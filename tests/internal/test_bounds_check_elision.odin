@@ -0,0 +1,72 @@
+package test_internal
+
+import "core:testing"
+
+@(private="file")
+sum_interval :: proc(s: []int) -> (total: int) {
+	for i in 0..<len(s) {
+		total += s[i]
+	}
+	return
+}
+
+@(private="file")
+sum_indexed :: proc(s: []int) -> (total: int) {
+	for _, i in s {
+		total += s[i]
+	}
+	return
+}
+
+@(private="file")
+add_into :: proc(dst, a, b: []int) {
+	for x, i in a {
+		dst[i] = x + b[i]
+	}
+}
+
+@test
+bounds_check_elision_loops :: proc(t: ^testing.T) {
+	arr: [16]int
+	for i in 0..<len(arr) {
+		arr[i] = i
+	}
+	for i in 0..=7 {
+		arr[i] += arr[15-i]
+	}
+	testing.expect_value(t, arr[0], 15)
+	testing.expect_value(t, arr[7], 15)
+	testing.expect_value(t, arr[8], 8)
+
+	s := arr[:]
+	testing.expect_value(t, sum_interval(s), sum_indexed(s))
+	testing.expect_value(t, sum_interval(s[:0]), 0)
+
+	// `dst` and `b` are checked against `len(a)` once before the loop
+	dst: [16]int
+	add_into(dst[:], s, s)
+	testing.expect_value(t, dst[15], 2*s[15])
+	add_into(dst[:4], s[:4], s[4:])
+	testing.expect_value(t, dst[3], s[3] + s[7])
+
+	str := "hellope"
+	count := 0
+	for _, i in str {
+		if str[i] == 'l' {
+			count += 1
+		}
+	}
+	testing.expect_value(t, count, 2)
+
+	// `d` is grown inside the loop, so its length is re-read and its checks are kept
+	d: [dynamic]int
+	defer delete(d)
+	append(&d, 1)
+	for i in 0..<len(d) {
+		if len(d) < 4 {
+			append(&d, d[i] * 2)
+		}
+	}
+	testing.expect_value(t, len(d), 4)
+	testing.expect_value(t, d[3], 8)
+}
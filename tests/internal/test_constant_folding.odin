@@ -0,0 +1,82 @@
+package test_internal
+
+import "core:testing"
+
+// Integer constants whose operands fit in a single big_int digit are folded with native i64 arithmetic.
+// These check the edges of that fast path against the expected values and the runtime operators.
+
+// Division by zero must still be reported, so this is expected to print 4 errors:
+//     odin check tests/internal/test_constant_folding.odin -file -no-entry-point -define:CONSTANT_FOLDING_EXPECT_DIVISION_BY_ZERO=true
+CONSTANT_FOLDING_EXPECT_DIVISION_BY_ZERO :: #config(CONSTANT_FOLDING_EXPECT_DIVISION_BY_ZERO, false)
+
+when CONSTANT_FOLDING_EXPECT_DIVISION_BY_ZERO {
+	DIVISION_BY_ZERO_QUO    :: 7 / 0
+	DIVISION_BY_ZERO_MOD    :: -7 % 0
+	DIVISION_BY_ZERO_MODMOD :: 7 %% 0
+	DIVISION_BY_ZERO_LARGE  :: (1 << 70) / 0
+}
+
+@test
+test_constant_folding_mul_overflow :: proc(t: ^testing.T) {
+	FITS      :: 3_037_000_499 * 3_037_000_499
+	OVERFLOW  :: 3_037_000_500 * 3_037_000_500
+	UNDERFLOW :: -3_037_000_500 * 3_037_000_500
+	MIN       :: -(1 << 59) * 16
+	PAST_MAX  :: (1 << 59) * 16
+
+	a := i128(3_037_000_500)
+	b := i128(1 << 59)
+	testing.expect_value(t, i64(FITS), 9_223_372_030_926_249_001)
+	testing.expect_value(t, i128(OVERFLOW), a * a)
+	testing.expect_value(t, i128(UNDERFLOW), -a * a)
+	testing.expect_value(t, i64(MIN), min(i64))
+	testing.expect_value(t, u64(PAST_MAX), u64(1) << 63)
+	testing.expect_value(t, i128(PAST_MAX), b * 16)
+}
+
+@test
+test_constant_folding_mod_negative_divisor :: proc(t: ^testing.T) {
+	testing.expect_value(t, i64(7 % -3), 1)
+	testing.expect_value(t, i64(-7 % 3), -1)
+	testing.expect_value(t, i64(-7 % -3), -1)
+	testing.expect_value(t, i64(7 %% -3), -2)
+	testing.expect_value(t, i64(-7 %% 3), 2)
+	testing.expect_value(t, i64(-7 %% -3), -1)
+	testing.expect_value(t, i64(6 %% -3), 0)
+
+	a, b := i64(7), i64(-3)
+	testing.expect_value(t, i64(7 % -3), a % b)
+	testing.expect_value(t, i64(-7 % -3), -a % b)
+	testing.expect_value(t, i64(7 %% -3), a %% b)
+	testing.expect_value(t, i64(-7 %% 3), -a %% -b)
+	testing.expect_value(t, i64(-7 %% -3), -a %% b)
+}
+
+@test
+test_constant_folding_shift_right_negative :: proc(t: ^testing.T) {
+	testing.expect_value(t, i64(-7 >> 1), -4)
+	testing.expect_value(t, i64(-8 >> 2), -2)
+	testing.expect_value(t, i64(-1 >> 63), -1)
+	testing.expect_value(t, i64(-(1 << 59) >> 59), -1)
+	testing.expect_value(t, i64(-5 >> 100), -1)
+
+	x := i64(-7)
+	testing.expect_value(t, i64(-7 >> 1), x >> 1)
+	testing.expect_value(t, i64(-7 >> 63), x >> 63)
+}
+
+@test
+test_constant_folding_shift_left_high_bits :: proc(t: ^testing.T) {
+	testing.expect_value(t, i64(1 << 62), 4_611_686_018_427_387_904)
+	testing.expect_value(t, i64(-1 << 62), -4_611_686_018_427_387_904)
+	testing.expect_value(t, i64(-1 << 63), min(i64))
+	testing.expect_value(t, u64(1 << 63), 9_223_372_036_854_775_808)
+	testing.expect_value(t, i128(3 << 62), 13_835_058_055_282_163_712)
+	testing.expect_value(t, i128(1 << 64), 18_446_744_073_709_551_616)
+
+	n := u64(1)
+	w := i128(3)
+	testing.expect_value(t, u64(1 << 63), n << 63)
+	testing.expect_value(t, i128(3 << 62), w << 62)
+	testing.expect_value(t, i128(3 << 63), w << 63)
+}
@@ -0,0 +1,64 @@
+package test_internal
+
+import "base:runtime"
+import "core:testing"
+
+@(private="file")
+dot3 :: proc(a, b: [3]f32) -> f32 {
+	return a.x*b.x + a.y*b.y + a.z*b.z
+}
+
+@(private="file")
+length_squared :: proc(v: [3]f32) -> f32 {
+	// only calls procedures which never touch `context`
+	return dot3(v, v)
+}
+
+@(private="file")
+allocating_sum :: proc(v: [3]f32) -> f32 {
+	// uses `context.allocator` after a context-free call
+	squared := length_squared(v)
+	buf := make([]f32, 3)
+	defer delete(buf)
+	buf[0] = squared
+	return buf[0] + f32(len(buf))
+}
+
+@(private="file")
+read_user_index :: proc(v: [3]f32) -> int {
+	return int(length_squared(v)) + context.user_index
+}
+
+// a weak definition may be replaced at link time by a body that reads `context`,
+// so its call sites must keep passing the real context
+@(private="file", linkage="weak")
+weak_scale :: proc(v: [3]f32) -> f32 {
+	return length_squared(v) * 2
+}
+
+@(private="file")
+call_weak_scale :: proc(v: [3]f32) -> int {
+	return int(weak_scale(v)) + context.user_index
+}
+
+@test
+context_elision :: proc(t: ^testing.T) {
+	v := [3]f32{1, 2, 3}
+	testing.expect_value(t, length_squared(v), 14)
+	testing.expect_value(t, allocating_sum(v), 17)
+
+	context.user_index = 100
+	testing.expect_value(t, read_user_index(v), 114)
+
+	// indirect calls still pass the real context
+	f := read_user_index
+	testing.expect_value(t, f(v), 114)
+
+	new_context := runtime.default_context()
+	new_context.user_index = 7
+	context = new_context
+	testing.expect_value(t, read_user_index(v), 21)
+
+	testing.expect_value(t, weak_scale(v), 28)
+	testing.expect_value(t, call_weak_scale(v), 35)
+}
@@ -1,5 +1,6 @@
 package test_internal
 
+import "base:runtime"
 import "core:log"
 import "base:intrinsics"
 import "core:math/rand"
@@ -337,3 +338,124 @@ test_union_key_should_not_be_hashing_specifc_variant :: proc(t: ^testing.T) {
 	testing.expect_value(t, bone_1 in m, true)
 	testing.expect_value(t, Id(bone_1) in m, true)
 }
+
+@test
+map_small_key_shapes :: proc(t: ^testing.T) {
+	// Keys of up to 32 bytes are hashed inline by the compiler, make sure every size and tail shape round trips
+	check :: proc(t: ^testing.T, $K: typeid, make_key: proc(i: int) -> K, loc := #caller_location) {
+		N :: 1_000
+		m: map[K]int
+		defer delete(m)
+
+		for i in 0..<N {
+			m[make_key(i)] = i
+		}
+		testing.expect_value(t, len(m), N, loc)
+		for i in 0..<N {
+			v, ok := m[make_key(i)]
+			testing.expectf(t, ok && v == i, "Expected m[%v] = %v, got %v (ok=%v)", make_key(i), i, v, ok, loc=loc)
+		}
+		testing.expect(t, make_key(N) not_in m, loc=loc)
+	}
+
+	Key3  :: struct #packed { a: u8, b: u16 }
+	Key12 :: struct { a: u32, b: u32, c: u32 }
+	Key24 :: struct { a: u64, b: u32, c: u16, d: u8, e: u8, f: u64 }
+
+	check(t, u16,     proc(i: int) -> u16     { return u16(i * 7) })
+	check(t, u64,     proc(i: int) -> u64     { return u64(i) << 32 })
+	check(t, rawptr,  proc(i: int) -> rawptr  { return rawptr(uintptr(i * 16)) })
+	check(t, [2]u64,  proc(i: int) -> [2]u64  { return {u64(i), u64(i) * 3} })
+	check(t, Key3,    proc(i: int) -> Key3    { return {u8(i), u16(i >> 8)} })
+	check(t, Key12,   proc(i: int) -> Key12   { return {u32(i), 0, u32(i * 5)} })
+	check(t, Key24,   proc(i: int) -> Key24   { return {0, u32(i), u16(i >> 4), 1, u8(i), u64(i) << 40} })
+	check(t, [33]u8,  proc(i: int) -> (k: [33]u8) { k[32] = u8(i); k[0] = u8(i >> 8); return })
+}
+
+@test
+map_get_group_probe :: proc(t: ^testing.T) {
+	// The generated map_get compares 4 stored hashes at once while `pos+4 <= cap`, and falls back to the
+	// scalar loop near the end of the hash array. Find keys whose probes take each of those paths.
+	GROUP :: 4
+	N     :: 4_000
+
+	m := make(map[int]int, 8 * 1024)
+	defer delete(m)
+	for i in 0..<N {
+		m[i] = i * 3
+	}
+
+	info := runtime.map_info(map[int]int)
+	raw  := transmute(runtime.Raw_Map)m
+	cap  := uintptr(runtime.map_cap(raw))
+	mask := cap - 1
+	seed := runtime.map_seed(raw)
+
+	// Make sure some keys want one of the slots where a group would run past the end of the hash array
+	extra := 0
+	for k := N; extra < 8; k += 1 {
+		key := k
+		if (info.key_hasher(&key, seed) & mask) + GROUP > cap {
+			m[key] = key * 3
+			extra += 1
+		}
+	}
+	raw = transmute(runtime.Raw_Map)m
+	testing.expect_value(t, uintptr(runtime.map_cap(raw)), cap)
+
+	ks, _, hs, _, _ := runtime.map_kvh_data_dynamic(raw, info)
+
+	lane_hits, tail_hits := 0, 0
+	for pos in 0..<cap {
+		hash := hs[pos]
+		if hash == 0 {
+			continue
+		}
+		desired  := hash & mask
+		distance := (pos - desired) & mask
+		switch {
+		case desired + GROUP > cap:
+			tail_hits += 1
+		case 1 <= distance && distance < GROUP:
+			lane_hits += 1
+		case:
+			continue
+		}
+		key := (^int)(runtime.map_cell_index_dynamic(ks, info.ks, pos))^
+		v, ok := m[key]
+		testing.expectf(t, ok && v == key * 3, "Expected m[%v] = %v, got %v (ok=%v, slot %v, desired %v)", key, key * 3, v, ok, pos, desired)
+	}
+	testing.expect(t, lane_hits > 0, "Expected keys displaced into lanes 1-3 of their group")
+	testing.expectf(t, tail_hits >= extra, "Expected at least %v keys near the end of the hash array, got %v", extra, tail_hits)
+
+	// Missing keys whose group is occupied from lane 0 up to an empty slot in lanes 1-3,
+	// with no occupant closer to its desired position before it to end the probe earlier
+	mid_group_misses := 0
+	for k := 2 * N; k < 1_000 * N && mid_group_misses < 16; k += 1 {
+		key := k
+		desired := info.key_hasher(&key, seed) & mask
+		if desired + GROUP > cap || hs[desired] == 0 {
+			continue
+		}
+		empty_lane := -1
+		for lane in uintptr(1)..<GROUP {
+			slot := desired + lane
+			if hs[slot] == 0 {
+				empty_lane = int(lane)
+				break
+			}
+			if lane > (slot - hs[slot]) & mask {
+				break
+			}
+		}
+		if empty_lane < 0 {
+			continue
+		}
+		mid_group_misses += 1
+
+		v, ok := m[key]
+		testing.expectf(t, !ok && v == 0, "Expected m[%v] to be missing, got %v (ok=%v, desired %v, empty lane %v)", key, v, ok, desired, empty_lane)
+		testing.expect(t, key not_in m)
+	}
+	testing.expect(t, mid_group_misses > 0, "Expected missing keys which stop at an empty slot in lanes 1-3")
+}
@@ -0,0 +1,50 @@
+package test_internal
+
+import "core:testing"
+
+// NOTE: `make` is only promoted to the stack with -o:size or higher. CI also runs this file on its own with
+// -o:size -show-optimization-remarks:stack, and checks that 'buf' and the first 's' were stack allocated
+
+@(private="file")
+sum_squares :: proc(n: int) -> (total: int) {
+	// never escapes, so it may be backed by a stack array
+	s := make([]int, 8)
+	defer delete(s)
+	for i in 0..<min(n, len(s)) {
+		s[i] = i*i
+	}
+	for x in s {
+		total += x
+	}
+	return
+}
+
+@(private="file")
+make_escaping :: proc() -> []int {
+	s := make([]int, 4)
+	s[3] = 7
+	return s
+}
+
+@test
+stack_make :: proc(t: ^testing.T) {
+	testing.expect_value(t, sum_squares(4), 0+1+4+9)
+	// the backing memory must be zeroed again on every call
+	testing.expect_value(t, sum_squares(2), 0+1)
+	testing.expect_value(t, sum_squares(100), 140)
+
+	total := 0
+	for round in 0..<3 {
+		buf := make([]u8, 16)
+		defer delete(buf)
+		testing.expect_value(t, buf[round], 0)
+		buf[round] = u8(round + 1)
+		total += int(buf[round]) + len(buf)
+	}
+	testing.expect_value(t, total, 1+2+3 + 3*16)
+
+	e := make_escaping()
+	defer delete(e)
+	testing.expect_value(t, e[3], 7)
+	testing.expect_value(t, len(e), 4)
+}
@@ -0,0 +1,66 @@
+package test_internal
+
+import "core:testing"
+
+@(private="file")
+keyword_index :: proc(s: string) -> int {
+	switch s {
+	case "":                         return 0
+	case "if":                       return 1
+	case "in":                       return 2
+	case "for", "fallthrough":       return 3
+	case "case":                     return 4
+	case "cast":                     return 5
+	case "when":                     return 6
+	case "where":                    return 7
+	case "struct":                   return 8
+	case "package":                  return 9
+	case "distinct":                 return 10
+	case "transmute":                return 11
+	case "a_rather_long_keyword_17": return 12
+	case "a_rather_long_keyword_18": return 13
+	}
+	return -1
+}
+
+@test
+string_switch :: proc(t: ^testing.T) {
+	Expect :: struct {
+		s:   string,
+		res: int,
+	}
+	tests := []Expect{
+		{"",                         0},
+		{"if",                       1},
+		{"in",                       2},
+		{"for",                      3},
+		{"fallthrough",              3},
+		{"case",                     4},
+		{"cast",                     5},
+		{"when",                     6},
+		{"where",                    7},
+		{"struct",                   8},
+		{"package",                  9},
+		{"distinct",                10},
+		{"transmute",               11},
+		{"a_rather_long_keyword_17", 12},
+		{"a_rather_long_keyword_18", 13},
+
+		// Misses sharing a length and/or discriminating bytes with real cases
+		{"i",                       -1},
+		{"io",                      -1},
+		{"fo",                      -1},
+		{"caso",                    -1},
+		{"cass",                    -1},
+		{"wherE",                   -1},
+		{"packagf",                 -1},
+		{"Package",                 -1},
+		{"distinct ",               -1},
+		{"a_rather_long_keyword_19", -1},
+		{"b_rather_long_keyword_17", -1},
+	}
+	for v in tests {
+		got := keyword_index(v.s)
+		testing.expectf(t, got == v.res, "Expected switch on %q to select %v, got %v", v.s, v.res, got)
+	}
+}
@@ -0,0 +1,121 @@
+package test_internal
+
+import "base:intrinsics"
+import "core:testing"
+
+// The generated equality procedure compares a struct as a whole only when byte equality is exactly value
+// equality: no padding and no floats. Everything else must still be compared field by field.
+
+@(private="file")
+fill_bytes :: proc(p: ^$T, b: u8) {
+	bytes := ([^]u8)(p)
+	for i in 0..<size_of(T) {
+		bytes[i] = b
+	}
+}
+
+@test
+struct_equal_ignores_padding :: proc(t: ^testing.T) {
+	Padded :: struct {
+		a: u8,
+		b: u32,
+		c: u16,
+	}
+	#assert(size_of(Padded) == 12)
+
+	x, y: Padded
+	fill_bytes(&x, 0xcc)
+	fill_bytes(&y, 0x33)
+	x.a, x.b, x.c = 1, 2, 3
+	y.a, y.b, y.c = 1, 2, 3
+
+	// NOTE: `==` on a simple compare struct compares the whole value byte-wise, so only the
+	// generated equality procedure (as used for map keys) has to look past the padding
+	equal := intrinsics.type_equal_proc(Padded)
+	testing.expect_value(t, equal(&x, &y), true)
+
+	y.c = 4
+	testing.expect_value(t, equal(&x, &y), false)
+}
+
+@test
+struct_equal_float_fields :: proc(t: ^testing.T) {
+	Float32 :: struct {
+		x: f32,
+		n: i32,
+	}
+	Float64 :: struct {
+		n: i64,
+		x: f64,
+	}
+
+	zero := f32(0)
+	nan  := f32(0h7fc0_0000)
+	a := Float32{zero, 7}
+	b := Float32{-zero, 7}
+	c := Float32{nan, 7}
+
+	equal32 := intrinsics.type_equal_proc(Float32)
+	testing.expect_value(t, equal32(&a, &b), true)
+	testing.expect_value(t, a == b, true)
+	d := c
+	testing.expect_value(t, equal32(&c, &d), false)
+	testing.expect_value(t, c == d, false)
+
+	zero64 := f64(0)
+	nan64  := f64(0h7ff8_0000_0000_0000)
+	e := Float64{7, zero64}
+	f := Float64{7, -zero64}
+	g := Float64{7, nan64}
+	h := g
+
+	equal64 := intrinsics.type_equal_proc(Float64)
+	testing.expect_value(t, equal64(&e, &f), true)
+	testing.expect_value(t, e == f, true)
+	testing.expect_value(t, equal64(&g, &h), false)
+	testing.expect_value(t, g == h, false)
+}
+
+@test
+struct_equal_memory_comparable :: proc(t: ^testing.T) {
+	// 15 bytes: the last 8 byte load overlaps the first one, for `==` as well as the equality procedure
+	Tail :: struct #packed {
+		a: u64,
+		b: u32,
+		c: u16,
+		d: u8,
+	}
+	// Larger than the inline compare, goes through runtime.memory_equal
+	Large :: struct {
+		data: [20]u32,
+		tag:  u64,
+	}
+	#assert(size_of(Tail) == 15)
+	#assert(size_of(Large) > 64)
+
+	check :: proc(t: ^testing.T, $T: typeid, loc := #caller_location) {
+		equal := intrinsics.type_equal_proc(T)
+
+		x, y: T
+		fill_bytes(&x, 0x5a)
+		fill_bytes(&y, 0x5a)
+		testing.expect_value(t, equal(&x, &y), true, loc)
+		testing.expect_value(t, x == y, true, loc)
+
+		m: map[T]int
+		defer delete(m)
+		m[x] = 1
+
+		for i in 0..<size_of(T) {
+			z := x
+			([^]u8)(&z)[i] ~= 0x01
+			testing.expectf(t, !equal(&x, &z), "Expected a difference in byte %v to compare unequal", i, loc=loc)
+			testing.expectf(t, x != z, "Expected a difference in byte %v to make `!=` true", i, loc=loc)
+			testing.expectf(t, z not_in m, "Expected a difference in byte %v to miss the map", i, loc=loc)
+		}
+		testing.expect_value(t, m[y], 1, loc)
+	}
+
+	check(t, Tail)
+	check(t, Large)
+}
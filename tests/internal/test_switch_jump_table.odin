@@ -0,0 +1,70 @@
+package test_internal
+
+import "core:testing"
+
+@(private="file")
+Char_Class :: enum {
+	Other,
+	Space,
+	Digit,
+	Lower,
+	Upper,
+	Ident,
+}
+
+@(private="file")
+char_class :: proc(r: rune) -> Char_Class {
+	switch r {
+	case ' ', '\t', '\r', '\n': return .Space
+	case '0'..='9':             return .Digit
+	case 'a'..<'{':             return .Lower
+	case 'A'..='Z':             return .Upper
+	case '_', 0x80..=0xff:      return .Ident
+	}
+	return .Other
+}
+
+@test
+switch_integer_ranges :: proc(t: ^testing.T) {
+	for r in rune(0)..<0x200 {
+		expected: Char_Class
+		switch {
+		case r == ' ' || r == '\t' || r == '\r' || r == '\n': expected = .Space
+		case r >= '0' && r <= '9':                           expected = .Digit
+		case r >= 'a' && r <= 'z':                           expected = .Lower
+		case r >= 'A' && r <= 'Z':                           expected = .Upper
+		case r == '_' || (r >= 0x80 && r <= 0xff):           expected = .Ident
+		case:                                                expected = .Other
+		}
+		testing.expectf(t, char_class(r) == expected, "Expected %x to be %v, got %v", r, expected, char_class(r))
+	}
+}
+
+@(private="file")
+typeid_index :: proc(id: typeid) -> int {
+	switch id {
+	case i8:          return 1
+	case i16, u16:    return 2
+	case int:         return 3
+	case f32:         return 4
+	case string:      return 5
+	case []u8:        return 6
+	case map[int]int: return 7
+	}
+	return 0
+}
+
+@test
+switch_typeid :: proc(t: ^testing.T) {
+	testing.expect_value(t, typeid_index(i8),          1)
+	testing.expect_value(t, typeid_index(i16),         2)
+	testing.expect_value(t, typeid_index(u16),         2)
+	testing.expect_value(t, typeid_index(int),         3)
+	testing.expect_value(t, typeid_index(f32),         4)
+	testing.expect_value(t, typeid_index(string),      5)
+	testing.expect_value(t, typeid_index([]u8),        6)
+	testing.expect_value(t, typeid_index(map[int]int), 7)
+	testing.expect_value(t, typeid_index(u8),          0)
+	testing.expect_value(t, typeid_index(f64),         0)
+	testing.expect_value(t, typeid_index([]i8),        0)
+}